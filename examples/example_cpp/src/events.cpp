@@ -78,6 +78,14 @@ extern void wyn_on_signal(void* const userdata)
     wyn_quit();
 }
 
+extern void wyn_on_watch(void* const userdata, void* const handle)
+{
+    App* const self = static_cast<App*>(userdata);
+    LOG("[EVENTS] (%" PRIu64 ") {%p} WATCH\n", static_cast<std::uint64_t>(++self->num_events), handle);
+    
+    wyn_unwatch(handle);
+}
+
 extern void wyn_on_window_close(void* const userdata, wyn_window_t const window)
 {
     App* const self = static_cast<App*>(userdata);
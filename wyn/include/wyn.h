@@ -138,6 +138,26 @@ extern wyn_bool_t wyn_is_this_thread(void);
  */
 extern void wyn_signal(void);
 
+/**
+ * @brief Attempts to watch a native waitable object, calling the `wyn_on_watch` user-callback whenever it is ready.
+ * @param[in] handle The object to watch:
+ * -     Xlib: File Descriptor, cast with `(void*)(intptr_t)fd`. Ready while readable.
+ * -    Win32: Unsupported.
+ * -    Cocoa: Unsupported.
+ * @return `true` if the object is watched, `false` on failure, such as when too many objects are watched.
+ * @note Readiness is level-triggered, so the user-callback must consume it (or unwatch the object) to not be called again immediately.
+ * @note A Wyt Waitable Semaphore can be watched via `wyt_evsem_native`, and consumed with `wyt_evsem_try_acquire`.
+ * @warning This function must only be called on the Event Thread, while the Event Loop is running.
+ */
+extern wyn_bool_t wyn_watch(void* handle);
+
+/**
+ * @brief Stops watching a native waitable object.
+ * @param[in] handle The object previously passed to `wyn_watch`. Does nothing if the object is not watched.
+ * @warning This function must only be called on the Event Thread. Objects must be unwatched before they are closed.
+ */
+extern void wyn_unwatch(void* handle);
+
 // --------------------------------------------------------------------------------------------------------------------------------
 
 /**
@@ -277,6 +297,13 @@ extern void wyn_on_stop(void* userdata);
  */
 extern void wyn_on_signal(void* userdata);
 
+/**
+ * @brief Called whenever an object watched with `wyn_watch` is ready.
+ * @param[in] userdata [nullable] The pointer provided by the user when the Event Loop was started.
+ * @param[in] handle   The object that is ready, as passed to `wyn_watch`.
+ */
+extern void wyn_on_watch(void* userdata, void* handle);
+
 /**
  * @brief Called when a Window is requested to close.
  * @param[in] userdata [nullable] The pointer provided by the user when the Event Loop was started.
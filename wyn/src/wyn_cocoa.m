@@ -526,6 +526,22 @@ extern void wyn_signal(void)
 
 // --------------------------------------------------------------------------------------------------------------------------------
 
+extern wyn_bool_t wyn_watch(void* const handle)
+{
+    // Not yet supported.
+    WYN_UNUSED(handle);
+    return false;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyn_unwatch(void* const handle)
+{
+    WYN_UNUSED(handle);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
 extern wyn_window_t wyn_window_open(void)
 {
     const NSRect rect = {
@@ -16,6 +16,9 @@ extern void __attribute__((weak)) wyn_on_stop(void* userdata)
 extern void __attribute__((weak)) wyn_on_signal(void* userdata)
 { (void)userdata; }
 
+extern void __attribute__((weak)) wyn_on_watch(void* userdata, void* handle)
+{ (void)userdata; wyn_unwatch(handle); }
+
 extern void __attribute__((weak)) wyn_on_window_close(void* userdata, wyn_window_t window)
 { (void)userdata; wyn_window_close(window); wyn_quit(); }
 
@@ -772,6 +772,22 @@ extern void wyn_signal(void)
 
 // --------------------------------------------------------------------------------------------------------------------------------
 
+extern wyn_bool_t wyn_watch(void* const handle)
+{
+    // Waiting on a HANDLE may consume it (such as decrementing a Semaphore), which would break the level-triggered contract.
+    WYN_UNUSED(handle);
+    return false;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyn_unwatch(void* const handle)
+{
+    WYN_UNUSED(handle);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
 extern wyn_window_t wyn_window_open(void)
 {
     /// @see CreateWindowExW | <Windows.h> <winuser.h> [User32] (Windows 2000) | https://learn.microsoft.com/en-us/windows/win32/api/winuser/nf-winuser-createwindowexw
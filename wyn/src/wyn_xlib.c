@@ -70,6 +70,11 @@ enum wyn_xlib_atom_t {
 };
 typedef enum wyn_xlib_atom_t wyn_xlib_atom_t;
 
+/**
+ * @brief Maximum number of File Descriptors watched with `wyn_watch`.
+ */
+#define WYN_XLIB_WATCH_MAX 16
+
 /**
  * @brief Names for Wyn X-Atoms.
  */
@@ -98,6 +103,9 @@ struct wyn_xlib_t
     int x11_fd; ///< File Descriptor for the X11 Connection.
     int evt_fd; ///< File Descriptor for the Event Signaler.
 
+    int watch_fds[WYN_XLIB_WATCH_MAX]; ///< File Descriptors watched with `wyn_watch`.
+    int watch_count; ///< Number of watched File Descriptors.
+
     int xrr_event_base; ///< Base value for XRR Events.
     int xrr_error_base; ///< Base value for XRR Errors.
 
@@ -139,6 +147,19 @@ static void wyn_xlib_dispatch_x11(wyn_bool_t sync);
  */
 static void wyn_xlib_dispatch_evt(void);
 
+/**
+ * @brief Responds to a watched File Descriptor becoming ready.
+ * @param fd The File Descriptor, which is ignored if it was unwatched in the meantime.
+ */
+static void wyn_xlib_dispatch_watch(int fd);
+
+/**
+ * @brief Finds a watched File Descriptor.
+ * @param fd The File Descriptor to find.
+ * @return The index of `fd` in the watch list, or -1 if it is not watched.
+ */
+static int wyn_xlib_find_watch(int fd);
+
 /**
 * @brief Xlib Error Handler.
 */
@@ -187,6 +208,8 @@ static wyn_bool_t wyn_xlib_reinit(void* userdata)
         .tid_main = 0,
         .x11_fd = -1,
         .evt_fd = -1,
+        .watch_fds = {0},
+        .watch_count = 0,
         .xrr_event_base = 0,
         .xrr_error_base = 0,
         .quitting = false,
@@ -291,14 +314,22 @@ static void wyn_xlib_event_loop(void)
 
     while (!wyn_quitting())
     {
-        enum { evt_idx, x11_idx, nfds };
+        enum { evt_idx, x11_idx, watch_idx, max_fds = watch_idx + WYN_XLIB_WATCH_MAX };
 
         /// @see poll | <poll.h> [libc] (Linux 2.1.23) | https://man7.org/linux/man-pages/man2/poll.2.html
-        struct pollfd fds[nfds] = {
+        struct pollfd fds[max_fds] = {
             [evt_idx] = { .fd = wyn_xlib.evt_fd, .events = POLLIN, .revents = 0 },
             [x11_idx] = { .fd = wyn_xlib.x11_fd, .events = POLLIN, .revents = 0 },
         };
-        const int res_poll = poll(fds, nfds, -1);
+
+        // The watch list may change during any callback, so the polled File Descriptors are a snapshot of it.
+        const int watch_count = wyn_xlib.watch_count;
+        for (int i = 0; i < watch_count; ++i)
+        {
+            fds[watch_idx + i] = (struct pollfd){ .fd = wyn_xlib.watch_fds[i], .events = POLLIN, .revents = 0 };
+        }
+
+        const int res_poll = poll(fds, (nfds_t)(watch_idx + watch_count), -1);
         WYN_ASSERT((res_poll != -1) && (res_poll != 0));
 
         const short evt_events = fds[evt_idx].revents;
@@ -315,6 +346,11 @@ static void wyn_xlib_event_loop(void)
             WYN_ASSERT(x11_events == POLLIN);
             wyn_xlib_dispatch_x11(false);
         }
+
+        for (int i = 0; i < watch_count; ++i)
+        {
+            if (fds[watch_idx + i].revents != 0) wyn_xlib_dispatch_watch(fds[watch_idx + i].fd);
+        }
     }
 
     wyn_quit();
@@ -580,6 +616,26 @@ static void wyn_xlib_dispatch_evt(void)
 
 // --------------------------------------------------------------------------------------------------------------------------------
 
+static void wyn_xlib_dispatch_watch(int const fd)
+{
+    if (wyn_xlib_find_watch(fd) == -1) return;
+
+    wyn_on_watch(wyn_xlib.userdata, (void*)(intptr_t)fd);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static int wyn_xlib_find_watch(int const fd)
+{
+    for (int i = 0; i < wyn_xlib.watch_count; ++i)
+    {
+        if (wyn_xlib.watch_fds[i] == fd) return i;
+    }
+    return -1;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
 /// @see XSetErrorHandler | <X11/Xlib.h> [libX11] (Xlib) | https://www.x.org/releases/current/doc/man/man3/XSetErrorHandler.3.xhtml | https://man.archlinux.org/man/extra/libx11/XSetErrorHandler.3.en
 static int wyn_xlib_error_handler(Display* const display, XErrorEvent* const error)
 {
@@ -685,6 +741,30 @@ extern void wyn_signal(void)
 
 // --------------------------------------------------------------------------------------------------------------------------------
 
+extern wyn_bool_t wyn_watch(void* const handle)
+{
+    const int fd = (int)(intptr_t)handle;
+    if (fd < 0) return false;
+
+    if (wyn_xlib_find_watch(fd) != -1) return true;
+    if (wyn_xlib.watch_count >= WYN_XLIB_WATCH_MAX) return false;
+
+    wyn_xlib.watch_fds[wyn_xlib.watch_count++] = fd;
+    return true;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyn_unwatch(void* const handle)
+{
+    const int idx = wyn_xlib_find_watch((int)(intptr_t)handle);
+    if (idx == -1) return;
+
+    wyn_xlib.watch_fds[idx] = wyn_xlib.watch_fds[--wyn_xlib.watch_count];
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
 extern wyn_window_t wyn_window_open(void)
 {
     /// @see DefaultScreenOfDisplay | <X11/Xlib.h> (Xlib) | https://www.x.org/releases/current/doc/man/man3/AllPlanes.3.xhtml | https://man.archlinux.org/man/extra/libx11/DefaultScreenOfDisplay.3.en
@@ -8,6 +8,8 @@
 #ifndef WYT_H
 #define WYT_H
 
+#include <stddef.h>
+
 // ================================================================================================================================
 //  Macros
 // --------------------------------------------------------------------------------------------------------------------------------
@@ -53,11 +55,37 @@ typedef unsigned long long wyt_utime_t;
  */
 typedef signed long long wyt_stime_t;
 
+/**
+ * @brief Clock sources that can be read by `wyt_nanotime_ex`.
+ * @details Each clock has its own epoch, so timepoints from different clocks must not be compared.
+ *          Only `wyt_clock_default` shares its epoch with the sleeping and waiting functions.
+ */
+enum wyt_clock_t
+{
+    wyt_clock_default,       ///< The clock used by `wyt_nanotime`.
+    wyt_clock_monotonic,     ///< Monotonic clock that may be slewed by time-synchronization. Does not count time spent suspended on Linux.
+    wyt_clock_monotonic_raw, ///< Monotonic clock that is never slewed by time-synchronization.
+    wyt_clock_coarse,        ///< Cheapest monotonic clock, with a resolution of roughly one scheduler tick (1-16ms).
+    wyt_clock_tsc,           ///< The CPU's timestamp counter, calibrated to nanoseconds. Falls back to `wyt_clock_monotonic` if the counter is not invariant.
+};
+typedef enum wyt_clock_t wyt_clock_t;
+
+/**
+ * @brief Handle to a periodic Ticker.
+ */
+typedef void* wyt_ticker_t;
+
 /**
  * @brief Handle to a Thread.
  */
 typedef void* wyt_thread_t;
 
+/**
+ * @brief Handle to a Waitable Semaphore, which can be waited on together with others, or watched by an event loop.
+ * @see wyt_wait_any
+ */
+typedef void* wyt_evsem_t;
+
 /**
  * @brief Return Value type for Wyt Threads.
  * @details Guaranteed to be either an Integer or a Pointer.
@@ -87,6 +115,70 @@ typedef void* wyt_thread_t;
  */
 typedef wyt_retval_t (WYT_ENTRY* wyt_entry_t)(void*);
 
+/**
+ * @brief Scheduling priority for Wyt Threads.
+ * @details Each value is mapped to the closest equivalent the platform provides.
+ */
+enum wyt_priority_t
+{
+    wyt_priority_default,  ///< Use the platform default (usually the same as `wyt_priority_normal`).
+    wyt_priority_idle,     ///< Only runs when the system would otherwise be idle.
+    wyt_priority_low,      ///< Throughput-oriented background work.
+    wyt_priority_normal,   ///< Regular time-sharing scheduling.
+    wyt_priority_high,     ///< Latency-sensitive work. May require elevated privileges.
+    wyt_priority_realtime, ///< Real-time scheduling. Usually requires elevated privileges.
+};
+typedef enum wyt_priority_t wyt_priority_t;
+
+/**
+ * @brief Optional attributes for spawning a Thread.
+ * @details Zero-initialized fields select the platform defaults.
+ */
+struct wyt_thread_attr_t
+{
+    size_t stack_size;                  ///< Size of the thread's stack in bytes, or 0 for the default. Rounded up to the platform's granularity.
+    const char* name;                   ///< [nullable] UTF-8 name shown by debuggers and profilers. Truncated to 15 bytes on Linux.
+    const unsigned long long* affinity; ///< [nullable] Bitmask of the CPUs the thread may run on. Bit `N % 64` of element `N / 64` selects CPU `N`.
+    size_t affinity_len;                ///< Number of elements in `affinity`.
+    wyt_priority_t priority;            ///< Scheduling priority of the thread.
+    wyt_evsem_t exit_signal;            ///< [nullable] Waitable Semaphore released once, when the thread returns from its entry-function or calls `wyt_exit`.
+};
+typedef struct wyt_thread_attr_t wyt_thread_attr_t;
+
+/**
+ * @brief Description of a single logical CPU.
+ * @details All indices are dense, starting at 0, and only count the CPUs listed in the owning `wyt_topology_t`.
+ */
+struct wyt_cpu_t
+{
+    unsigned int id;      ///< OS index of the CPU, as used by `wyt_thread_attr_t::affinity`.
+    unsigned int core;    ///< Index of the physical core. SMT siblings share the same core.
+    unsigned int package; ///< Index of the physical package (socket).
+    unsigned int node;    ///< Index of the NUMA node.
+    unsigned int l2;      ///< Index of the L2 cache this CPU uses. CPUs with the same index share the cache.
+    unsigned int l3;      ///< Index of the L3 cache this CPU uses. CPUs with the same index share the cache.
+};
+typedef struct wyt_cpu_t wyt_cpu_t;
+
+/**
+ * @brief Description of the CPUs available to the current process.
+ */
+struct wyt_topology_t
+{
+    unsigned int cpu_count;     ///< Number of CPUs the process may run on. (The length of `cpus`)
+    unsigned int core_count;    ///< Number of distinct physical cores.
+    unsigned int package_count; ///< Number of distinct physical packages.
+    unsigned int node_count;    ///< Number of distinct NUMA nodes.
+    unsigned int l2_count;      ///< Number of distinct L2 caches.
+    unsigned int l3_count;      ///< Number of distinct L3 caches.
+    unsigned int quota;         ///< Number of CPUs worth of time the process may use (e.g. due to cgroup quotas), rounded up. At most `cpu_count`.
+    size_t l1d_size;            ///< Size in bytes of each L1 Data cache, or 0 if unknown.
+    size_t l2_size;             ///< Size in bytes of each L2 cache, or 0 if unknown.
+    size_t l3_size;             ///< Size in bytes of each L3 cache, or 0 if unknown.
+    const wyt_cpu_t* cpus;      ///< [non-null] Array of CPUs, sorted by `id`.
+};
+typedef struct wyt_topology_t wyt_topology_t;
+
 /**
  * @brief Integer capable of holding a Thread Identifier.
  * @details A Thread ID is guaranteed to be unique at least as long as the thread is still running.
@@ -104,6 +196,221 @@ typedef unsigned long long wyt_pid_t;
  */
 typedef void* wyt_sem_t;
 
+/**
+ * @brief 32-bit Unsigned Integer that threads can wait on.
+ * @see wyt_wait
+ */
+typedef unsigned int wyt_word_t;
+
+/**
+ * @brief A Timepoint that is never reached.
+ * @details Waiting functions given this deadline will wait indefinitely.
+ */
+#define WYT_FOREVER (~(wyt_utime_t)0)
+
+/**
+ * @brief Handle to a reusable Barrier.
+ */
+typedef void* wyt_barrier_t;
+
+/**
+ * @brief Callback function that runs once each time a Barrier's phase completes.
+ * @param[in] userdata [nullable] Pointer specified when calling `wyt_barrier_create`.
+ */
+typedef void (*wyt_barrier_callback_t)(void* userdata);
+
+/**
+ * @brief Handle to a single-use Latch.
+ */
+typedef void* wyt_latch_t;
+
+/**
+ * @brief Handle to an Event Count.
+ */
+typedef void* wyt_evcount_t;
+
+/**
+ * @brief Handle to a Timer Wheel, which schedules large numbers of deadline callbacks.
+ */
+typedef void* wyt_wheel_t;
+
+/**
+ * @brief Handle to a Timer scheduled on a Timer Wheel.
+ * @details The value 0 is never a valid handle. Handles of timers that have fired or been cancelled become stale, and are never reused.
+ */
+typedef unsigned long long wyt_timer_t;
+
+/**
+ * @brief Callback function that runs when a Timer expires.
+ * @param[in] userdata [nullable] Pointer specified when calling `wyt_wheel_schedule`.
+ */
+typedef void (*wyt_timer_callback_t)(void* userdata);
+
+/**
+ * @brief Handle to a bounded Single-Producer Single-Consumer Queue.
+ */
+typedef void* wyt_spsc_t;
+
+/**
+ * @brief Handle to a bounded Multi-Producer Multi-Consumer Queue.
+ */
+typedef void* wyt_mpmc_t;
+
+/**
+ * @brief Handle to a Triple Buffer, which shares the latest version of a value from one writer to one reader.
+ */
+typedef void* wyt_triple_buffer_t;
+
+/**
+ * @brief Handle to a Sequence Lock, which protects small, read-mostly values.
+ */
+typedef void* wyt_seqlock_t;
+
+/**
+ * @brief Handle to an Epoch-Based Reclamation domain.
+ */
+typedef void* wyt_ebr_t;
+
+/**
+ * @brief Handle to a Thread's registration with an Epoch-Based Reclamation domain.
+ */
+typedef void* wyt_ebr_thread_t;
+
+/**
+ * @brief Callback function that reclaims a retired object.
+ * @param[in] ptr [non-null] Pointer specified when calling `wyt_ebr_retire`.
+ */
+typedef void (*wyt_ebr_reclaim_t)(void* ptr);
+
+/**
+ * @brief Handle to a Fiber, a cooperatively scheduled user-mode thread of execution with its own stack.
+ */
+typedef void* wyt_fiber_t;
+
+/**
+ * @brief Entry-function of a Fiber.
+ * @param[in] arg [nullable] Argument specified when creating the fiber.
+ */
+typedef void (*wyt_fiber_entry_t)(void* arg);
+
+/**
+ * @brief Handle to a Worker Pool, a fixed set of threads that run submitted work.
+ */
+typedef void* wyt_workers_t;
+
+/**
+ * @brief Callback function that performs a unit of work.
+ * @param[in] userdata [nullable] Pointer specified when submitting the work.
+ */
+typedef void (*wyt_work_callback_t)(void* userdata);
+
+/**
+ * @brief Handle to a Task Graph, a set of work items with dependencies between them that can be run repeatedly.
+ */
+typedef void* wyt_graph_t;
+
+/**
+ * @brief Identifier of a Node within a Task Graph.
+ * @details The value 0 never identifies a valid node.
+ */
+typedef unsigned int wyt_graph_node_t;
+
+/**
+ * @brief Handle to a Future, a value that becomes available once some asynchronous work completes.
+ */
+typedef void* wyt_future_t;
+
+/**
+ * @brief Callback function that continues asynchronous work once a Future has completed.
+ * @param[in] userdata [nullable] Pointer specified when calling `wyt_future_then`.
+ * @param[in] value [nullable] The value the Future completed with.
+ * @return [nullable] The value to complete the continuation's own Future with.
+ */
+typedef void* (*wyt_future_callback_t)(void* userdata, void* value);
+
+/**
+ * @brief Handle to an Arena, a bump allocator whose allocations are all freed at once.
+ */
+typedef void* wyt_arena_t;
+
+/**
+ * @brief Position within an Arena, which allocations made after it can be rewound to.
+ */
+struct wyt_arena_mark_t
+{
+    void* chunk;    ///< [non-null] The chunk that was being allocated from.
+    void* position; ///< [non-null] The next free byte of `chunk`.
+};
+typedef struct wyt_arena_mark_t wyt_arena_mark_t;
+
+/**
+ * @brief Handle to a Pool of fixed-size objects.
+ */
+typedef void* wyt_pool_t;
+
+/**
+ * @brief Statistics of a Pool.
+ * @details Counts are gathered from per-thread caches in batches, so up to a few thousand operations per thread may not be counted yet.
+ */
+struct wyt_pool_stats_t
+{
+    size_t allocs;      ///< Number of objects allocated.
+    size_t cache_hits;  ///< Number of allocations served by the allocating thread's own cache.
+    size_t global_hits; ///< Number of objects taken from the shared free list.
+    size_t slabs;       ///< Number of slabs allocated. Each slab holds twice as many objects as the previous one.
+    size_t objects;     ///< Number of objects the slabs can hold.
+    size_t bytes;       ///< Number of bytes allocated by the pool, including its own bookkeeping.
+};
+typedef struct wyt_pool_stats_t wyt_pool_stats_t;
+
+/**
+ * @brief Handle to a Thread-Local Storage key, which holds a separate value for every thread.
+ */
+typedef void* wyt_tls_t;
+
+/**
+ * @brief Function called with the value of a Thread-Local Storage key, when a thread holding a non-NULL value exits.
+ * @param[in] value [non-null] The thread's value.
+ */
+typedef void (*wyt_tls_destructor_t)(void* value);
+
+/**
+ * @brief Handle to a bounded Channel, which passes fixed-size messages between threads until it is closed.
+ */
+typedef void* wyt_chan_t;
+
+/**
+ * @brief Outcome of an operation on a Channel.
+ */
+enum wyt_chan_result_t
+{
+    wyt_chan_ok,      ///< The message was sent or received.
+    wyt_chan_timeout, ///< The channel was full (sending) or empty (receiving) until the deadline passed.
+    wyt_chan_closed,  ///< The channel was closed, and (when receiving) all of its messages have been received.
+};
+typedef enum wyt_chan_result_t wyt_chan_result_t;
+
+/**
+ * @brief A single send or receive operation considered by `wyt_select`.
+ */
+struct wyt_select_case_t
+{
+    wyt_chan_t chan; ///< [non-null] Handle to the channel.
+    wyt_bool_t send; ///< `true` to send `message` to the channel, `false` to receive a message into it.
+    void* message;   ///< [non-null] The message to send, or the buffer to receive into.
+};
+typedef struct wyt_select_case_t wyt_select_case_t;
+
+/**
+ * @brief Handle to a named Shared Memory segment, which can be mapped by several processes.
+ */
+typedef void* wyt_shm_t;
+
+/**
+ * @brief Handle to a single-producer single-consumer byte Ring in Shared Memory, which passes data between two processes.
+ */
+typedef void* wyt_shring_t;
+
 // ================================================================================================================================
 //  API Functions
 // --------------------------------------------------------------------------------------------------------------------------------
@@ -118,6 +425,14 @@ extern "C" {
  */
 extern wyt_utime_t wyt_nanotime(void);
 
+/**
+ * @brief Gets a nanosecond timepoint (relative to an unspecified epoch) from a specific clock.
+ * @details Unknown clocks are treated as `wyt_clock_default`.
+ * @param source The clock to read.
+ * @return The approximate timepoint the function was called at.
+ */
+extern wyt_utime_t wyt_nanotime_ex(wyt_clock_t source);
+
 /**
  * @brief Sleeps the current thread for at least `duration` nanoseconds.
  * @details If the duration is less than or equal to 0, this function will return immediately.
@@ -132,6 +447,67 @@ extern void wyt_nanosleep_for(wyt_stime_t duration);
  */
 extern void wyt_nanosleep_until(wyt_utime_t timepoint);
 
+/**
+ * @brief Sleeps the current thread until `timepoint`, trading CPU time for precision.
+ * @details The thread sleeps until shortly before the timepoint, then busy-waits for the remainder.
+ *          The length of the busy-wait adapts (per thread) to how late the preceding sleeps have woken up.
+ *          If the timepoint has already passed, this function will return immediately.
+ * @param timepoint The timepoint to sleep until, based on the same clock as `wyt_nanotime`.
+ */
+extern void wyt_precise_sleep_until(wyt_utime_t timepoint);
+
+/**
+ * @brief Gets the timer slack of the current thread.
+ * @details Timer slack is how late the OS may deliberately wake up a sleeping thread, in order to batch wake-ups.
+ * @return The timer slack in nanoseconds, or 0 if the platform has no such concept.
+ */
+extern wyt_utime_t wyt_timer_slack_get(void);
+
+/**
+ * @brief Sets the timer slack of the current thread.
+ * @details Affects all subsequent sleeps and timed waits on this thread, including `wyt_nanosleep_until` and `wyt_nanosleep_for`.
+ * @param slack The timer slack in nanoseconds, or 0 to restore the default.
+ * @return `true` if successful, `false` if unsupported by the platform.
+ */
+extern wyt_bool_t wyt_timer_slack_set(wyt_utime_t slack);
+
+/**
+ * @brief Switches the current thread into (or out of) a profile that minimizes wake-up latency, at the cost of power efficiency.
+ * @details Intended for frame-pacing and audio threads. The profile currently consists of:
+ *            - Linux: Minimal timer slack.
+ *            - MacOS: The user-interactive QoS class.
+ *            - Windows: Opting out of execution-speed power throttling. (EcoQoS)
+ * @param enable `true` to enable the profile, `false` to restore the defaults.
+ * @return `true` if successful, `false` otherwise.
+ */
+extern wyt_bool_t wyt_low_latency(wyt_bool_t enable);
+
+/**
+ * @brief Attempts to create a new ticker, which fires at a fixed rate without accumulating drift.
+ * @details Tick `N` is scheduled at `T + N * period`, where `T` is the time of creation, regardless of how long each tick takes to process.
+ * @param period [positive] The number of nanoseconds between ticks.
+ * @return [nullable] NON-NULL handle to the new ticker on success, NULL on failure.
+ * @warning If successful, the returned handle must be passed to `wyt_ticker_destroy` in order to not leak resources.
+ */
+extern wyt_ticker_t wyt_ticker_create(wyt_utime_t period);
+
+/**
+ * @brief Destroys a ticker.
+ * @param ticker [non-null] Handle to the ticker to destroy.
+ * @warning No threads may be waiting on the ticker.
+ */
+extern void wyt_ticker_destroy(wyt_ticker_t ticker);
+
+/**
+ * @brief Blocks the current thread until the next tick of a ticker.
+ * @details If one or more ticks have already passed since the previous call, returns immediately and consumes all of them.
+ *          A ticker may only be waited on by one thread at a time.
+ * @param ticker [non-null] Handle to the ticker to wait on.
+ * @param[out] missed [nullable] Receives the number of ticks that were skipped over, ie: passed before the previous tick was waited for.
+ * @return The scheduled timepoint of the latest tick, based on the same clock as `wyt_nanotime`.
+ */
+extern wyt_utime_t wyt_ticker_wait(wyt_ticker_t ticker, wyt_utime_t* missed);
+
 /**
  * @brief Yields execution of the current thread temporarily.
  */
@@ -146,6 +522,31 @@ extern void wyt_yield(void);
  */
 extern wyt_thread_t wyt_spawn(wyt_entry_t func, void* arg);
 
+/**
+ * @brief Attempts to spawn a new thread with the specified attributes.
+ * @details Attributes that are not supported by the platform are ignored. (E.g. affinity on MacOS)
+ * @param[in] func [non-null] The entry-function to call on the new thread.
+ * @param[in] arg  [nullable] The argument to pass to the thread's entry-function.
+ * @param[in] attr [nullable] The attributes to create the thread with. NULL is equivalent to calling `wyt_spawn`.
+ * @return [nullable] NON-NULL handle to the new thread on success, NULL on failure.
+ * @warning If successful, the returned handle must be passed to either `wyt_join` or `wyt_detach` in order to not leak resources.
+ * @warning Spawning fails if the process lacks the privileges for the requested priority or affinity.
+ */
+extern wyt_thread_t wyt_spawn_ex(wyt_entry_t func, void* arg, const wyt_thread_attr_t* attr);
+
+/**
+ * @brief Attempts to run a function on a pooled thread, reusing a parked thread when one is available.
+ * @details The returned handle has the same contract as one returned by `wyt_spawn`, and the function may call `wyt_exit`.
+ *          Once the function returns, its thread parks for up to 10 seconds waiting to be reused.
+ *          Threads that call `wyt_exit` are not reused.
+ * @param[in] func [non-null] The entry-function to call on the pooled thread.
+ * @param[in] arg  [nullable] The argument to pass to the thread's entry-function.
+ * @return [nullable] NON-NULL handle to the pooled thread on success, NULL on failure.
+ * @warning If successful, the returned handle must be passed to either `wyt_join` or `wyt_detach` in order to not leak resources.
+ * @warning Thread-local variables and per-thread settings (such as names and priorities) carry over between functions run on the same thread.
+ */
+extern wyt_thread_t wyt_spawn_pooled(wyt_entry_t func, void* arg);
+
 /**
  * @brief Terminates the current thread.
  * @details The effects are the same as returning from the thread's entry-function.
@@ -162,6 +563,28 @@ WYT_NORETURN extern void wyt_exit(wyt_retval_t retval);
  */
 extern wyt_retval_t wyt_join(wyt_thread_t thread);
 
+/**
+ * @brief Joins the specified thread if it has already terminated, without waiting.
+ * @details Equivalent to calling `wyt_join_until` with a deadline of 0.
+ * @param[in] thread [non-null] A handle to the thread to join.
+ * @param[out] retval [nullable] Receives the value returned by the thread, if joined.
+ * @return `true` if the thread was joined, `false` if it is still running.
+ * @warning If joined, the thread handle is invalid and must not be used. Otherwise it must still be joined or detached.
+ * @warning A thread must not attempt to join itself.
+ */
+extern wyt_bool_t wyt_try_join(wyt_thread_t thread, wyt_retval_t* retval);
+
+/**
+ * @brief Waits until the specified thread has terminated, or until a deadline has passed.
+ * @param[in] thread [non-null] A handle to the thread to join.
+ * @param deadline The timepoint to wait until, based on the same clock as `wyt_nanotime`. May be `WYT_FOREVER`, or 0 to poll.
+ * @param[out] retval [nullable] Receives the value returned by the thread, if joined.
+ * @return `true` if the thread was joined, `false` if the deadline passed first.
+ * @warning If joined, the thread handle is invalid and must not be used. Otherwise it must still be joined or detached.
+ * @warning A thread must not attempt to join itself.
+ */
+extern wyt_bool_t wyt_join_until(wyt_thread_t thread, wyt_utime_t deadline, wyt_retval_t* retval);
+
 /**
  * @brief Detaches the specified thread, allowing it to execute independently.
  * @param[in] thread [non-null] A handle to the thread to detach.
@@ -182,6 +605,22 @@ extern wyt_tid_t wyt_tid(void);
  */
 extern wyt_pid_t wyt_pid(void);
 
+/**
+ * @brief Queries the CPU topology available to the current process.
+ * @details Only the CPUs in the process's affinity mask are reported.
+ *          If a cache level does not exist or cannot be queried, each core (L2) or package (L3) is assumed to have its own.
+ * @return [nullable] NON-NULL pointer to the topology on success, NULL on failure.
+ * @warning If successful, the returned pointer must be passed to `wyt_topology_free` in order to not leak resources.
+ */
+extern wyt_topology_t* wyt_topology_query(void);
+
+/**
+ * @brief Frees a topology returned by `wyt_topology_query`.
+ * @param[in] topology [non-null] Pointer to a topology.
+ * @warning After calling this function, the pointer is invalid and must not be used.
+ */
+extern void wyt_topology_free(wyt_topology_t* topology);
+
 /**
  * @brief Attempts to create a new semaphore.
  * @param maximum [positive] The suggested maximum value the internal counter can have.
@@ -197,6 +636,7 @@ extern wyt_sem_t wyt_sem_create(int maximum, int initial);
  * @param[in] sem [non-null] Handle to a semaphore.
  * @warning After calling this function, the semaphore handle is invalid and must not be used.
  * @warning On some platforms, the internal counter must be greater than or equal its initial value when destroyed, otherwise an error occurs.
+ * @note Semaphores returned by `wyt_sem_open` are only closed in the current process.
  */
 extern void wyt_sem_destroy(wyt_sem_t sem);
 
@@ -221,6 +661,1040 @@ extern void wyt_sem_acquire(wyt_sem_t sem);
  */
 extern wyt_bool_t wyt_sem_try_acquire(wyt_sem_t sem);
 
+/**
+ * @brief Blocks the current thread while the word at `address` holds the value `expected`.
+ * @details Returns immediately if the word does not hold `expected` at the time of the call.
+ *          The comparison and the sleep happen atomically with respect to `wyt_wake_one`/`wyt_wake_all`.
+ * @param[in] address [non-null] Pointer to the word to wait on.
+ * @param expected The value the word must hold for the thread to sleep.
+ * @param deadline The timepoint to wait until, based on the same clock as `wyt_nanotime`. May be `WYT_FOREVER`.
+ * @return `false` if the deadline passed, `true` otherwise.
+ * @warning This function may return spuriously. Callers must re-check the value of the word.
+ */
+extern wyt_bool_t wyt_wait(const wyt_word_t* address, wyt_word_t expected, wyt_utime_t deadline);
+
+/**
+ * @brief Wakes at most one thread blocked in `wyt_wait` on the word at `address`.
+ * @param[in] address [non-null] Pointer to the word to wake.
+ * @note The word may already have been freed, so that a waiter can free it as soon as it observes the change that released it.
+ */
+extern void wyt_wake_one(const wyt_word_t* address);
+
+/**
+ * @brief Wakes all threads blocked in `wyt_wait` on the word at `address`.
+ * @param[in] address [non-null] Pointer to the word to wake.
+ * @note The word may already have been freed, so that a waiter can free it as soon as it observes the change that released it.
+ */
+extern void wyt_wake_all(const wyt_word_t* address);
+
+/**
+ * @brief Attempts to create a new barrier.
+ * @param count [positive] The number of threads that must arrive to complete each phase. Must not exceed 65535.
+ * @param callback [nullable] Function to call after the last thread arrives, but before any threads are released.
+ * @param userdata [nullable] Pointer to pass to `callback`.
+ * @return [nullable] NON-NULL handle to the new barrier on success, NULL on failure.
+ * @warning If successful, the returned handle must be passed to `wyt_barrier_destroy` in order to not leak resources.
+ */
+extern wyt_barrier_t wyt_barrier_create(unsigned int count, wyt_barrier_callback_t callback, void* userdata);
+
+/**
+ * @brief Destroys a barrier.
+ * @param[in] barrier [non-null] Handle to a barrier.
+ * @warning After calling this function, the barrier handle is invalid and must not be used.
+ * @warning No threads may be waiting on the barrier when it is destroyed.
+ */
+extern void wyt_barrier_destroy(wyt_barrier_t barrier);
+
+/**
+ * @brief Arrives at the barrier, blocking until all threads have arrived in the current phase.
+ * @details The barrier automatically resets for the next phase once all threads are released.
+ * @param[in] barrier [non-null] Handle to a barrier.
+ * @return `true` for the single thread that ran the completion callback, `false` for all others.
+ */
+extern wyt_bool_t wyt_barrier_arrive_and_wait(wyt_barrier_t barrier);
+
+/**
+ * @brief Attempts to create a new latch.
+ * @param count [non-negative] The number of times the latch must be counted down before it opens.
+ * @return [nullable] NON-NULL handle to the new latch on success, NULL on failure.
+ * @warning If successful, the returned handle must be passed to `wyt_latch_destroy` in order to not leak resources.
+ */
+extern wyt_latch_t wyt_latch_create(unsigned int count);
+
+/**
+ * @brief Destroys a latch.
+ * @param[in] latch [non-null] Handle to a latch.
+ * @warning After calling this function, the latch handle is invalid and must not be used.
+ * @warning No threads may be waiting on the latch when it is destroyed.
+ */
+extern void wyt_latch_destroy(wyt_latch_t latch);
+
+/**
+ * @brief Decrements the latch's internal counter, opening the latch if it reaches 0.
+ * @param[in] latch [non-null] Handle to a latch.
+ * @param count The amount to decrement by. Must not exceed the current value of the counter.
+ */
+extern void wyt_latch_count_down(wyt_latch_t latch, unsigned int count);
+
+/**
+ * @brief Blocks until the latch is open.
+ * @param[in] latch [non-null] Handle to a latch.
+ * @param deadline The timepoint to wait until, based on the same clock as `wyt_nanotime`. May be `WYT_FOREVER`, or 0 to poll.
+ * @return `true` if the latch is open, `false` if the deadline passed first.
+ */
+extern wyt_bool_t wyt_latch_wait(wyt_latch_t latch, wyt_utime_t deadline);
+
+/**
+ * @brief Attempts to create a new event count.
+ * @details An event count lets threads sleep until a condition on lock-free data changes, without costing notifiers a syscall when nobody is waiting.
+ *          Waiters call `wyt_evcount_prepare`, re-check their condition, then call `wyt_evcount_wait` with the returned key.
+ *          Notifiers update the data, then call `wyt_evcount_notify`.
+ * @return [nullable] NON-NULL handle to the new event count on success, NULL on failure.
+ * @warning If successful, the returned handle must be passed to `wyt_evcount_destroy` in order to not leak resources.
+ */
+extern wyt_evcount_t wyt_evcount_create(void);
+
+/**
+ * @brief Destroys an event count.
+ * @param[in] evcount [non-null] Handle to an event count.
+ * @warning After calling this function, the event count handle is invalid and must not be used.
+ * @warning No threads may be waiting on the event count when it is destroyed.
+ */
+extern void wyt_evcount_destroy(wyt_evcount_t evcount);
+
+/**
+ * @brief Announces that the current thread is about to wait on the event count.
+ * @param[in] evcount [non-null] Handle to an event count.
+ * @return A key to pass to `wyt_evcount_wait`. The key may be discarded if the thread decides not to wait.
+ */
+extern wyt_word_t wyt_evcount_prepare(wyt_evcount_t evcount);
+
+/**
+ * @brief Blocks until the event count has been notified since `key` was obtained.
+ * @param[in] evcount [non-null] Handle to an event count.
+ * @param key The value returned by `wyt_evcount_prepare`.
+ * @param deadline The timepoint to wait until, based on the same clock as `wyt_nanotime`. May be `WYT_FOREVER`.
+ * @return `true` if notified, `false` if the deadline passed first.
+ */
+extern wyt_bool_t wyt_evcount_wait(wyt_evcount_t evcount, wyt_word_t key, wyt_utime_t deadline);
+
+/**
+ * @brief Wakes all threads waiting on the event count.
+ * @details Only performs a syscall if there are threads that have prepared to wait.
+ * @param[in] evcount [non-null] Handle to an event count.
+ */
+extern void wyt_evcount_notify(wyt_evcount_t evcount);
+
+/**
+ * @brief Attempts to create a new timer wheel.
+ * @details Timers never fire early, and fire at most `resolution` nanoseconds late (plus scheduling latency).
+ *          Deadlines up to `2^32 * resolution` nanoseconds in the future are handled in O(1); later ones are revisited once per such period.
+ * @param resolution [positive] The granularity of the wheel in nanoseconds.
+ * @return [nullable] NON-NULL handle to the new timer wheel on success, NULL on failure.
+ * @warning If successful, the returned handle must be passed to `wyt_wheel_destroy` in order to not leak resources.
+ */
+extern wyt_wheel_t wyt_wheel_create(wyt_utime_t resolution);
+
+/**
+ * @brief Destroys a timer wheel. Pending timers are discarded without being called.
+ * @param wheel [non-null] Handle to the timer wheel to destroy.
+ * @warning The wheel must not be running a driver thread, or be in use by any other threads.
+ */
+extern void wyt_wheel_destroy(wyt_wheel_t wheel);
+
+/**
+ * @brief Schedules a callback to run once a deadline is reached.
+ * @details Runs in O(1). May be called from any thread, including from within timer callbacks.
+ * @param wheel [non-null] Handle to the timer wheel.
+ * @param deadline The timepoint to fire at, based on the same clock as `wyt_nanotime`.
+ * @param callback [non-null] The function to call.
+ * @param userdata [nullable] Pointer to pass to `callback`.
+ * @return Handle to the timer on success, or 0 on failure.
+ */
+extern wyt_timer_t wyt_wheel_schedule(wyt_wheel_t wheel, wyt_utime_t deadline, wyt_timer_callback_t callback, void* userdata);
+
+/**
+ * @brief Cancels a pending timer.
+ * @details Runs in O(1). May be called from any thread, including from within timer callbacks.
+ * @param wheel [non-null] Handle to the timer wheel.
+ * @param timer Handle to the timer to cancel. May be stale.
+ * @return `true` if the timer was cancelled, `false` if it has already fired (or started firing) or been cancelled.
+ */
+extern wyt_bool_t wyt_wheel_cancel(wyt_wheel_t wheel, wyt_timer_t timer);
+
+/**
+ * @brief Fires all timers whose deadlines have been reached, on the current thread.
+ * @details Allows a wheel to be pumped from an existing loop, instead of by a driver thread.
+ *          Callbacks are called without any internal locks held.
+ * @param wheel [non-null] Handle to the timer wheel.
+ * @param now The current timepoint, based on the same clock as `wyt_nanotime`.
+ * @return The number of callbacks that were called.
+ * @warning Must not be called concurrently with itself, or while the wheel is running a driver thread.
+ */
+extern size_t wyt_wheel_advance(wyt_wheel_t wheel, wyt_utime_t now);
+
+/**
+ * @brief Spawns a driver thread that fires the timers of a wheel as their deadlines are reached.
+ * @details The driver sleeps until the next deadline, and is woken up early when an earlier timer is scheduled.
+ * @param wheel [non-null] Handle to the timer wheel.
+ * @return `true` if successful, `false` if the driver thread could not be spawned or is already running.
+ */
+extern wyt_bool_t wyt_wheel_start(wyt_wheel_t wheel);
+
+/**
+ * @brief Stops the driver thread of a wheel, and waits for it to exit. Pending timers remain scheduled.
+ * @param wheel [non-null] Handle to the timer wheel.
+ * @warning Must not be called from within a timer callback.
+ */
+extern void wyt_wheel_stop(wyt_wheel_t wheel);
+
+/**
+ * @brief Attempts to create a new lock-free single-producer single-consumer queue.
+ * @details Elements are copied in and out by value, in FIFO order.
+ *          At any time, at most one thread may push (the producer), and at most one thread may pop (the consumer).
+ * @param capacity [positive] The maximum number of elements in the queue. Rounded up to a power of 2.
+ * @param size [positive] The size of each element in bytes.
+ * @return [nullable] NON-NULL handle to the new queue on success, NULL on failure.
+ * @warning If successful, the returned handle must be passed to `wyt_spsc_destroy` in order to not leak resources.
+ */
+extern wyt_spsc_t wyt_spsc_create(size_t capacity, size_t size);
+
+/**
+ * @brief Destroys a single-producer single-consumer queue. Remaining elements are discarded.
+ * @param spsc [non-null] Handle to the queue to destroy.
+ * @warning No threads may be using the queue.
+ */
+extern void wyt_spsc_destroy(wyt_spsc_t spsc);
+
+/**
+ * @brief Pushes as many elements as will fit onto the back of the queue, without blocking.
+ * @details May only be called by the producer. Batching elements amortizes the cost of synchronization.
+ * @param spsc [non-null] Handle to the queue.
+ * @param[in] elements [non-null] Array of `count` elements to push.
+ * @param count The number of elements to push.
+ * @return The number of elements that were pushed, which is less than `count` if the queue became full.
+ */
+extern size_t wyt_spsc_push(wyt_spsc_t spsc, const void* elements, size_t count);
+
+/**
+ * @brief Pops as many elements as are available from the front of the queue, without blocking.
+ * @details May only be called by the consumer. Batching elements amortizes the cost of synchronization.
+ * @param spsc [non-null] Handle to the queue.
+ * @param[out] elements [non-null] Array to copy up to `count` popped elements into.
+ * @param count The maximum number of elements to pop.
+ * @return The number of elements that were popped, which is less than `count` if the queue became empty.
+ */
+extern size_t wyt_spsc_pop(wyt_spsc_t spsc, void* elements, size_t count);
+
+/**
+ * @brief Blocks the producer until the queue has room for at least one element.
+ * @details May only be called by the producer.
+ * @param spsc [non-null] Handle to the queue.
+ * @param deadline The timepoint to wait until, based on the same clock as `wyt_nanotime`. May be `WYT_FOREVER`.
+ * @return `true` if there is room, `false` if the deadline passed first.
+ */
+extern wyt_bool_t wyt_spsc_wait_push(wyt_spsc_t spsc, wyt_utime_t deadline);
+
+/**
+ * @brief Blocks the consumer until the queue holds at least one element.
+ * @details May only be called by the consumer.
+ * @param spsc [non-null] Handle to the queue.
+ * @param deadline The timepoint to wait until, based on the same clock as `wyt_nanotime`. May be `WYT_FOREVER`.
+ * @return `true` if there are elements, `false` if the deadline passed first.
+ */
+extern wyt_bool_t wyt_spsc_wait_pop(wyt_spsc_t spsc, wyt_utime_t deadline);
+
+/**
+ * @brief Attempts to create a new lock-free multi-producer multi-consumer queue.
+ * @details Elements are copied in and out by value. Any number of threads may push and pop concurrently.
+ * @param capacity [positive] The maximum number of elements in the queue. Rounded up to a power of 2, with a minimum of 2.
+ * @param size [positive] The size of each element in bytes.
+ * @return [nullable] NON-NULL handle to the new queue on success, NULL on failure.
+ * @warning If successful, the returned handle must be passed to `wyt_mpmc_destroy` in order to not leak resources.
+ */
+extern wyt_mpmc_t wyt_mpmc_create(size_t capacity, size_t size);
+
+/**
+ * @brief Destroys a multi-producer multi-consumer queue. Remaining elements are discarded.
+ * @param mpmc [non-null] Handle to the queue to destroy.
+ * @warning No threads may be using the queue.
+ */
+extern void wyt_mpmc_destroy(wyt_mpmc_t mpmc);
+
+/**
+ * @brief Attempts to push an element onto the back of the queue, without blocking.
+ * @param mpmc [non-null] Handle to the queue.
+ * @param[in] element [non-null] The element to push.
+ * @return `true` if the element was pushed, `false` if the queue was full.
+ */
+extern wyt_bool_t wyt_mpmc_try_push(wyt_mpmc_t mpmc, const void* element);
+
+/**
+ * @brief Attempts to pop an element from the front of the queue, without blocking.
+ * @param mpmc [non-null] Handle to the queue.
+ * @param[out] element [non-null] Receives the popped element.
+ * @return `true` if an element was popped, `false` if the queue was empty.
+ */
+extern wyt_bool_t wyt_mpmc_try_pop(wyt_mpmc_t mpmc, void* element);
+
+/**
+ * @brief Pushes an element onto the back of the queue, blocking while the queue is full.
+ * @param mpmc [non-null] Handle to the queue.
+ * @param[in] element [non-null] The element to push.
+ * @param deadline The timepoint to wait until, based on the same clock as `wyt_nanotime`. May be `WYT_FOREVER`.
+ * @return `true` if the element was pushed, `false` if the deadline passed first.
+ */
+extern wyt_bool_t wyt_mpmc_push(wyt_mpmc_t mpmc, const void* element, wyt_utime_t deadline);
+
+/**
+ * @brief Pops an element from the front of the queue, blocking while the queue is empty.
+ * @param mpmc [non-null] Handle to the queue.
+ * @param[out] element [non-null] Receives the popped element.
+ * @param deadline The timepoint to wait until, based on the same clock as `wyt_nanotime`. May be `WYT_FOREVER`.
+ * @return `true` if an element was popped, `false` if the deadline passed first.
+ */
+extern wyt_bool_t wyt_mpmc_pop(wyt_mpmc_t mpmc, void* element, wyt_utime_t deadline);
+
+/**
+ * @brief Attempts to create a new wait-free triple buffer.
+ * @details The writer fills in its slot (obtained with `wyt_triple_buffer_write`) and publishes it, never waiting for the reader.
+ *          The reader always sees the most recently published slot, never waiting for the writer, and never seeing a partially written value.
+ *          At any time, at most one thread may write, and at most one thread may read.
+ * @param size [positive] The size of each slot in bytes. All three slots are initially zero-filled.
+ * @return [nullable] NON-NULL handle to the new triple buffer on success, NULL on failure.
+ * @warning If successful, the returned handle must be passed to `wyt_triple_buffer_destroy` in order to not leak resources.
+ */
+extern wyt_triple_buffer_t wyt_triple_buffer_create(size_t size);
+
+/**
+ * @brief Destroys a triple buffer.
+ * @param buffer [non-null] Handle to the triple buffer to destroy.
+ * @warning No threads may be using the triple buffer.
+ */
+extern void wyt_triple_buffer_destroy(wyt_triple_buffer_t buffer);
+
+/**
+ * @brief Gets the slot currently owned by the writer.
+ * @details May only be called by the writer. The slot holds stale data, from whichever value was published two or more times ago (or zeros).
+ * @param buffer [non-null] Handle to the triple buffer.
+ * @return [non-null] Pointer to the writer's slot, valid until the next call to `wyt_triple_buffer_publish`.
+ */
+extern void* wyt_triple_buffer_write(wyt_triple_buffer_t buffer);
+
+/**
+ * @brief Publishes the writer's slot as the latest value, and hands the writer a different slot.
+ * @details May only be called by the writer. Wait-free.
+ * @param buffer [non-null] Handle to the triple buffer.
+ */
+extern void wyt_triple_buffer_publish(wyt_triple_buffer_t buffer);
+
+/**
+ * @brief Gets the latest published value.
+ * @details May only be called by the reader. Wait-free.
+ * @param buffer [non-null] Handle to the triple buffer.
+ * @param[out] updated [nullable] Receives whether a new value has been published since the previous call.
+ * @return [non-null] Pointer to the reader's slot, valid until the next call to `wyt_triple_buffer_read`.
+ */
+extern const void* wyt_triple_buffer_read(wyt_triple_buffer_t buffer, wyt_bool_t* updated);
+
+/**
+ * @brief Attempts to create a new sequence lock, which holds a copy of a value.
+ * @details Readers never block writers, and never write to shared memory, so reads scale with the number of readers.
+ *          Readers retry if a write happened concurrently, so the value should be small and writes should be infrequent.
+ * @param size [positive] The size of the value in bytes. The value is initially zero-filled.
+ * @return [nullable] NON-NULL handle to the new sequence lock on success, NULL on failure.
+ * @warning If successful, the returned handle must be passed to `wyt_seqlock_destroy` in order to not leak resources.
+ */
+extern wyt_seqlock_t wyt_seqlock_create(size_t size);
+
+/**
+ * @brief Destroys a sequence lock.
+ * @param seqlock [non-null] Handle to the sequence lock to destroy.
+ * @warning No threads may be using the sequence lock.
+ */
+extern void wyt_seqlock_destroy(wyt_seqlock_t seqlock);
+
+/**
+ * @brief Replaces the value of a sequence lock.
+ * @details May be called from any number of threads; concurrent writers are serialized.
+ * @param seqlock [non-null] Handle to the sequence lock.
+ * @param[in] value [non-null] The new value, of the size given to `wyt_seqlock_create`.
+ */
+extern void wyt_seqlock_write(wyt_seqlock_t seqlock, const void* value);
+
+/**
+ * @brief Copies out a consistent snapshot of the value of a sequence lock.
+ * @details May be called from any number of threads. Retries while a write is in progress.
+ * @param seqlock [non-null] Handle to the sequence lock.
+ * @param[out] value [non-null] Receives the value, of the size given to `wyt_seqlock_create`.
+ */
+extern void wyt_seqlock_read(wyt_seqlock_t seqlock, void* value);
+
+/**
+ * @brief Attempts to create a new epoch-based reclamation domain.
+ * @details Lock-free data structures retire nodes they have unlinked, instead of freeing them immediately.
+ *          Retired nodes are reclaimed once every thread that could still be reading them has left its critical section.
+ * @param backlog [positive] The number of retired objects per thread after which retiring (or leaving a critical section) blocks until garbage is reclaimed.
+ * @return [nullable] NON-NULL handle to the new domain on success, NULL on failure.
+ * @warning If successful, the returned handle must be passed to `wyt_ebr_destroy` in order to not leak resources.
+ */
+extern wyt_ebr_t wyt_ebr_create(size_t backlog);
+
+/**
+ * @brief Destroys an epoch-based reclamation domain, reclaiming all remaining retired objects.
+ * @param ebr [non-null] Handle to the domain to destroy.
+ * @warning All threads must have been unregistered.
+ */
+extern void wyt_ebr_destroy(wyt_ebr_t ebr);
+
+/**
+ * @brief Registers the current thread with an epoch-based reclamation domain.
+ * @param ebr [non-null] Handle to the domain.
+ * @return [nullable] NON-NULL handle to the registration on success, NULL on failure.
+ * @warning If successful, the returned handle must be passed to `wyt_ebr_unregister` by the same thread before it exits.
+ */
+extern wyt_ebr_thread_t wyt_ebr_register(wyt_ebr_t ebr);
+
+/**
+ * @brief Unregisters the current thread from its epoch-based reclamation domain.
+ * @details Objects retired by the thread that cannot be reclaimed yet are handed over to the domain.
+ * @param thread [non-null] Handle to the current thread's registration.
+ * @warning Must not be called from within a critical section.
+ */
+extern void wyt_ebr_unregister(wyt_ebr_thread_t thread);
+
+/**
+ * @brief Enters a critical section, during which objects retired by other threads will not be reclaimed.
+ * @details Critical sections may be nested.
+ * @param thread [non-null] Handle to the current thread's registration.
+ */
+extern void wyt_ebr_enter(wyt_ebr_thread_t thread);
+
+/**
+ * @brief Leaves a critical section entered with `wyt_ebr_enter`.
+ * @details When leaving the outermost critical section with a full backlog, blocks until garbage is reclaimed.
+ * @param thread [non-null] Handle to the current thread's registration.
+ */
+extern void wyt_ebr_leave(wyt_ebr_thread_t thread);
+
+/**
+ * @brief Retires an object that has been unlinked from a shared data structure, to be reclaimed once no thread can be reading it.
+ * @details When called outside a critical section with a full backlog, blocks until garbage is reclaimed.
+ * @param thread [non-null] Handle to the current thread's registration.
+ * @param ptr [non-null] The object to retire.
+ * @param reclaim [non-null] The function to reclaim the object with. Called on an arbitrary registered thread, or by `wyt_ebr_destroy`.
+ */
+extern void wyt_ebr_retire(wyt_ebr_thread_t thread, void* ptr, wyt_ebr_reclaim_t reclaim);
+
+/**
+ * @brief Blocks until every object retired by the current thread has been reclaimed.
+ * @param thread [non-null] Handle to the current thread's registration.
+ * @warning Must not be called from within a critical section.
+ */
+extern void wyt_ebr_flush(wyt_ebr_thread_t thread);
+
+/**
+ * @brief Attempts to create a new fiber, which does not run until it is switched to.
+ * @details Stacks are reserved with an inaccessible guard page below them, and are recycled when fibers are destroyed.
+ * @param func [non-null] The entry-function of the fiber.
+ * @param arg [nullable] The argument to pass to `func`.
+ * @param stack_size The size of the stack in bytes, or 0 for the default (256 KiB).
+ * @return [nullable] NON-NULL handle to the new fiber on success, NULL on failure.
+ * @warning If successful, the returned handle must be passed to `wyt_fiber_destroy` in order to not leak resources.
+ */
+extern wyt_fiber_t wyt_fiber_create(wyt_fiber_entry_t func, void* arg, size_t stack_size);
+
+/**
+ * @brief Destroys a fiber.
+ * @details Destroying a fiber that has not returned from its entry-function abandons it, without unwinding its stack.
+ * @param fiber [non-null] Handle to the fiber to destroy.
+ * @warning Must not be the currently running fiber, nor a handle returned by `wyt_fiber_current` for a thread.
+ */
+extern void wyt_fiber_destroy(wyt_fiber_t fiber);
+
+/**
+ * @brief Returns a handle to the currently running fiber.
+ * @details If the current thread is not running a fiber, returns a handle representing the thread itself.
+ *          It may be switched back to, but must not be destroyed, and is only valid until the thread exits.
+ * @return [non-null] Handle to the current fiber.
+ */
+extern wyt_fiber_t wyt_fiber_current(void);
+
+/**
+ * @brief Suspends the current fiber, and resumes `fiber` on the current thread.
+ * @details When the entry-function of a fiber returns, execution switches back to whichever fiber most recently switched to it.
+ * @param fiber [non-null] Handle to the fiber to resume.
+ * @warning A fiber must not be resumed after its entry-function has returned.
+ * @warning A suspended fiber must only be resumed by the thread it last ran on, as compilers may cache thread-local addresses across the switch.
+ */
+extern void wyt_fiber_switch(wyt_fiber_t fiber);
+
+/**
+ * @brief Attempts to create a new fiber and add it to the current thread's scheduler.
+ * @details Scheduled fibers are run in FIFO order by `wyt_fiber_run`, and are destroyed once their entry-function returns.
+ * @param func [non-null] The entry-function of the fiber.
+ * @param arg [nullable] The argument to pass to `func`.
+ * @param stack_size The size of the stack in bytes, or 0 for the default.
+ * @return `true` if the fiber was scheduled, `false` on failure.
+ */
+extern wyt_bool_t wyt_fiber_spawn(wyt_fiber_entry_t func, void* arg, size_t stack_size);
+
+/**
+ * @brief Runs the fibers scheduled on the current thread, until all of them have returned.
+ * @details Fibers may spawn further fibers while running.
+ * @warning Must not be called from within a scheduled fiber.
+ */
+extern void wyt_fiber_run(void);
+
+/**
+ * @brief Suspends the current scheduled fiber, allowing other fibers on the same thread to run.
+ * @details If not called from within a scheduled fiber, behaves like `wyt_yield`.
+ */
+extern void wyt_fiber_yield(void);
+
+/**
+ * @brief Suspends the current scheduled fiber while the word at `address` holds the value `expected`, running other fibers on the same thread meanwhile.
+ * @details The word may be changed by other fibers, or by other threads followed by `wyt_wake_one`/`wyt_wake_all`.
+ *          If every other fiber on the thread is waiting as well, the thread itself sleeps in `wyt_wait`.
+ *          If not called from within a scheduled fiber, behaves like `wyt_wait`.
+ * @param[in] address [non-null] Pointer to the word to wait on.
+ * @param expected The value the word must hold for the fiber to wait.
+ * @param deadline The timepoint to wait until, based on the same clock as `wyt_nanotime`. May be `WYT_FOREVER`.
+ * @return `false` if the deadline passed, `true` otherwise.
+ * @warning This function may return spuriously. Callers must re-check the value of the word.
+ */
+extern wyt_bool_t wyt_fiber_wait(const wyt_word_t* address, wyt_word_t expected, wyt_utime_t deadline);
+
+/**
+ * @brief Attempts to create a new worker pool.
+ * @param count [positive] The number of worker threads.
+ * @param capacity [positive] The maximum number of work items waiting to run. Rounded up to a power of 2.
+ * @return [nullable] NON-NULL handle to the new worker pool on success, NULL on failure.
+ * @warning If successful, the returned handle must be passed to `wyt_workers_destroy` in order to not leak resources.
+ */
+extern wyt_workers_t wyt_workers_create(unsigned int count, size_t capacity);
+
+/**
+ * @brief Destroys a worker pool, after running all work submitted to it.
+ * @param workers [non-null] Handle to the worker pool to destroy.
+ * @warning Must not be called from a worker thread of the pool, nor concurrently with `wyt_workers_submit`.
+ */
+extern void wyt_workers_destroy(wyt_workers_t workers);
+
+/**
+ * @brief Submits work to be run by one of the threads of a worker pool.
+ * @details Blocks while the pool's queue is full. If called from one of the pool's own threads, runs the work immediately instead.
+ * @param workers [non-null] Handle to the worker pool.
+ * @param func [non-null] The function to run.
+ * @param userdata [nullable] The argument to pass to `func`.
+ */
+extern void wyt_workers_submit(wyt_workers_t workers, wyt_work_callback_t func, void* userdata);
+
+/**
+ * @brief Attempts to create a new, empty task graph.
+ * @details Nodes and dependencies are added once, after which the graph can be run any number of times without allocating.
+ * @param workers [non-null] Handle to the worker pool to run the graph's nodes on.
+ * @return [nullable] NON-NULL handle to the new graph on success, NULL on failure.
+ * @warning If successful, the returned handle must be passed to `wyt_graph_destroy` in order to not leak resources.
+ */
+extern wyt_graph_t wyt_graph_create(wyt_workers_t workers);
+
+/**
+ * @brief Destroys a task graph.
+ * @param graph [non-null] Handle to the graph to destroy.
+ * @warning The graph must not be running.
+ */
+extern void wyt_graph_destroy(wyt_graph_t graph);
+
+/**
+ * @brief Attempts to add a node to a task graph.
+ * @param graph [non-null] Handle to the graph.
+ * @param func [non-null] The function to run each time the graph is run.
+ * @param userdata [nullable] The argument to pass to `func`.
+ * @return The identifier of the new node on success, 0 on failure.
+ * @warning The graph must not be running.
+ */
+extern wyt_graph_node_t wyt_graph_add(wyt_graph_t graph, wyt_work_callback_t func, void* userdata);
+
+/**
+ * @brief Attempts to make a node of a task graph wait for another node to finish before it starts.
+ * @param graph [non-null] Handle to the graph.
+ * @param node [non-zero] The node that must wait.
+ * @param dependency [non-zero] The node that must finish first.
+ * @return `true` on success, `false` on failure.
+ * @warning The graph must not be running, and dependencies must not form a cycle.
+ */
+extern wyt_bool_t wyt_graph_depend(wyt_graph_t graph, wyt_graph_node_t node, wyt_graph_node_t dependency);
+
+/**
+ * @brief Runs every node of a task graph once, in dependency order, and blocks until all of them have finished.
+ * @details Nodes without dependencies between them may run in parallel on the graph's worker pool.
+ *          The calling thread runs nodes as well, rather than sleeping while work is available.
+ * @param graph [non-null] Handle to the graph to run.
+ * @warning Must not be called concurrently for the same graph.
+ */
+extern void wyt_graph_run(wyt_graph_t graph);
+
+/**
+ * @brief Attempts to create a new, pending future.
+ * @details Futures are reference-counted. The caller owns one reference to the new future.
+ * @return [nullable] NON-NULL handle to the new future on success, NULL on failure.
+ * @warning If successful, the returned handle must be passed to `wyt_future_release` in order to not leak resources.
+ */
+extern wyt_future_t wyt_future_create(void);
+
+/**
+ * @brief Acquires an additional reference to a future, such as for the thread that will complete it.
+ * @param future [non-null] Handle to the future.
+ */
+extern void wyt_future_retain(wyt_future_t future);
+
+/**
+ * @brief Releases a reference to a future, destroying it once no references remain.
+ * @param future [non-null] Handle to the future.
+ * @warning A future that has continuations must be completed before its last reference is released.
+ */
+extern void wyt_future_release(wyt_future_t future);
+
+/**
+ * @brief Completes a future with a value, waking its waiters and dispatching its continuations.
+ * @details Continuations without a worker pool run on the current thread before this function returns.
+ * @param future [non-null] Handle to a pending future that was created by `wyt_future_create`.
+ * @param value [nullable] The value to complete the future with.
+ * @warning Each future must be completed at most once.
+ */
+extern void wyt_future_complete(wyt_future_t future, void* value);
+
+/**
+ * @brief Checks whether a future has completed.
+ * @param future [non-null] Handle to the future.
+ * @return `true` if the future has completed, `false` if it is pending.
+ */
+extern wyt_bool_t wyt_future_ready(wyt_future_t future);
+
+/**
+ * @brief Blocks the current thread until a future has completed.
+ * @param future [non-null] Handle to the future.
+ * @param deadline The timepoint to wait until, based on the same clock as `wyt_nanotime`. May be `WYT_FOREVER`.
+ * @return `true` if the future has completed, `false` if the deadline passed first.
+ */
+extern wyt_bool_t wyt_future_wait(wyt_future_t future, wyt_utime_t deadline);
+
+/**
+ * @brief Returns the value a future completed with.
+ * @param future [non-null] Handle to a completed future.
+ * @return [nullable] The value passed to `wyt_future_complete`, or returned by the continuation that produced the future.
+ */
+extern void* wyt_future_value(wyt_future_t future);
+
+/**
+ * @brief Attempts to schedule a continuation to run once a future has completed.
+ * @details If the future has already completed, the continuation is dispatched immediately.
+ * @param future [non-null] Handle to the future to continue from.
+ * @param func [non-null] The continuation, which receives the value of `future`.
+ * @param userdata [nullable] The first argument to pass to `func`.
+ * @param workers [nullable] The worker pool to run `func` on, or NULL to run it on the thread that completes `future`.
+ * @return [nullable] NON-NULL handle to a new future that completes with the return value of `func` on success, NULL on failure.
+ * @warning If successful, the returned handle must be passed to `wyt_future_release` in order to not leak resources.
+ */
+extern wyt_future_t wyt_future_then(wyt_future_t future, wyt_future_callback_t func, void* userdata, wyt_workers_t workers);
+
+/**
+ * @brief Attempts to create a new arena.
+ * @details Memory is mapped directly from the OS in chunks, which are kept for reuse until the arena is destroyed.
+ * @param chunk_size The size of each chunk in bytes, or 0 for the default (1 MiB). Larger allocations get a chunk of their own.
+ * @return [nullable] NON-NULL handle to the new arena on success, NULL on failure.
+ * @warning If successful, the returned handle must be passed to `wyt_arena_destroy` in order to not leak resources.
+ * @warning Arenas are not thread-safe. Each arena must only be used by one thread at a time.
+ */
+extern wyt_arena_t wyt_arena_create(size_t chunk_size);
+
+/**
+ * @brief Destroys an arena, freeing all memory allocated from it.
+ * @param arena [non-null] Handle to the arena to destroy.
+ * @warning Must not be called for the arena returned by `wyt_arena_local`.
+ */
+extern void wyt_arena_destroy(wyt_arena_t arena);
+
+/**
+ * @brief Attempts to allocate memory from an arena.
+ * @details The memory is uninitialized, and stays valid until the arena is reset, rewound past it, or destroyed.
+ * @param arena [non-null] Handle to the arena.
+ * @param size The number of bytes to allocate.
+ * @param align [power-of-2] The alignment of the allocation in bytes.
+ * @return [nullable] NON-NULL pointer to the allocation on success, NULL on failure.
+ */
+extern void* wyt_arena_alloc(wyt_arena_t arena, size_t size, size_t align);
+
+/**
+ * @brief Frees every allocation of an arena in constant time, keeping its chunks for reuse.
+ * @param arena [non-null] Handle to the arena.
+ */
+extern void wyt_arena_reset(wyt_arena_t arena);
+
+/**
+ * @brief Returns the current position of an arena.
+ * @param arena [non-null] Handle to the arena.
+ * @return A mark that can be passed to `wyt_arena_rewind`.
+ */
+extern wyt_arena_mark_t wyt_arena_mark(wyt_arena_t arena);
+
+/**
+ * @brief Frees every allocation made from an arena since a mark was taken, in constant time.
+ * @param arena [non-null] Handle to the arena.
+ * @param mark A mark returned by `wyt_arena_mark` for the same arena.
+ * @warning Marks are invalidated by rewinding to an earlier mark, and by resetting the arena.
+ */
+extern void wyt_arena_rewind(wyt_arena_t arena, wyt_arena_mark_t mark);
+
+/**
+ * @brief Returns the current thread's own arena, creating it on first use.
+ * @details The arena is destroyed when the thread exits.
+ * @note On Windows, every fiber (including those of `wyt_fiber_create`) has its own arena, which is destroyed along with the fiber.
+ * @return [nullable] NON-NULL handle to the thread's arena on success, NULL on failure.
+ */
+extern wyt_arena_t wyt_arena_local(void);
+
+/**
+ * @brief Attempts to create a pool of fixed-size objects.
+ * @details Freed objects are kept in a small cache of the freeing thread, and overflow into a lock-free list shared by all threads.
+ *          Each thread's cache is returned to the shared list when the thread exits.
+ *          Only the first few pools alive at a time get per-thread caches. The rest always use the shared list.
+ * @param size The size of each object in bytes.
+ * @param align [power-of-2] The alignment of each object in bytes.
+ * @return [nullable] NON-NULL handle to the new pool on success, NULL on failure.
+ * @warning If successful, the returned handle must be passed to `wyt_pool_destroy` in order to not leak resources.
+ */
+extern wyt_pool_t wyt_pool_create(size_t size, size_t align);
+
+/**
+ * @brief Destroys a pool, freeing all of its objects.
+ * @param pool [non-null] Handle to the pool to destroy.
+ */
+extern void wyt_pool_destroy(wyt_pool_t pool);
+
+/**
+ * @brief Attempts to allocate an object from a pool.
+ * @param pool [non-null] Handle to the pool.
+ * @return [nullable] NON-NULL pointer to an uninitialized object on success, NULL on failure.
+ */
+extern void* wyt_pool_alloc(wyt_pool_t pool);
+
+/**
+ * @brief Returns an object to a pool. May be called by any thread.
+ * @param pool [non-null] Handle to the pool.
+ * @param ptr [non-null] Pointer to the object, as returned by `wyt_pool_alloc` for the same pool.
+ */
+extern void wyt_pool_free(wyt_pool_t pool, void* ptr);
+
+/**
+ * @brief Returns the statistics of a pool.
+ * @param[in] pool [non-null] Handle to the pool.
+ * @param[out] stats [non-null] Receives the statistics.
+ */
+extern void wyt_pool_stats(wyt_pool_t pool, wyt_pool_stats_t* stats);
+
+/**
+ * @brief Attempts to create a Thread-Local Storage key.
+ * @details Every thread's value starts as NULL.
+ * @param destructor [nullable] Function to call with the value of each thread that exits (or calls `wyt_exit`) while holding a non-NULL value.
+ * @return [nullable] NON-NULL handle to the new key on success, NULL on failure, such as when too many keys exist.
+ * @warning If successful, the returned handle must be passed to `wyt_tls_destroy` in order to not leak resources.
+ * @note Threads of `wyt_spawn_pooled` keep their values from one task to the next.
+ * @note On Windows, every fiber (including those of `wyt_fiber_create`) has its own values, which are destroyed along with the fiber.
+ */
+extern wyt_tls_t wyt_tls_create(wyt_tls_destructor_t destructor);
+
+/**
+ * @brief Destroys a Thread-Local Storage key, without calling its destructor for any values.
+ * @param tls [non-null] Handle to the key to destroy.
+ */
+extern void wyt_tls_destroy(wyt_tls_t tls);
+
+/**
+ * @brief Returns the current thread's value of a Thread-Local Storage key.
+ * @param tls [non-null] Handle to the key.
+ * @return [nullable] The value last set by the current thread, or NULL if there is none.
+ */
+extern void* wyt_tls_get(wyt_tls_t tls);
+
+/**
+ * @brief Attempts to set the current thread's value of a Thread-Local Storage key.
+ * @details The previous value is replaced without calling the destructor.
+ * @param tls [non-null] Handle to the key.
+ * @param value [nullable] The new value.
+ * @return `true` on success, `false` on failure.
+ */
+extern wyt_bool_t wyt_tls_set(wyt_tls_t tls, void* value);
+
+/**
+ * @brief Attempts to create a new Waitable Semaphore.
+ * @details Unlike `wyt_sem_t`, the semaphore is backed by a native waitable object, so that it can be passed to `wyt_wait_any` or watched by an event loop.
+ * @param initial [non-negative] The initial value of the internal counter.
+ * @return [nullable] NON-NULL handle to the new semaphore on success, NULL on failure.
+ * @warning If successful, the returned handle must be passed to `wyt_evsem_destroy` in order to not leak resources.
+ */
+extern wyt_evsem_t wyt_evsem_create(int initial);
+
+/**
+ * @brief Destroys a Waitable Semaphore.
+ * @param[in] evsem [non-null] Handle to the semaphore.
+ * @warning After calling this function, the semaphore handle is invalid and must not be used.
+ */
+extern void wyt_evsem_destroy(wyt_evsem_t evsem);
+
+/**
+ * @brief Attempts to increment the Waitable Semaphore's internal counter.
+ * @param[in] evsem [non-null] Handle to the semaphore.
+ * @return `true` if successful, `false` if the counter is at its maximum.
+ * @note This function may be called from any thread.
+ */
+extern wyt_bool_t wyt_evsem_release(wyt_evsem_t evsem);
+
+/**
+ * @brief Decrements the Waitable Semaphore's internal counter, blocking until successful.
+ * @param[in] evsem [non-null] Handle to the semaphore.
+ */
+extern void wyt_evsem_acquire(wyt_evsem_t evsem);
+
+/**
+ * @brief Attempts to decrement the Waitable Semaphore's internal counter, without blocking.
+ * @param[in] evsem [non-null] Handle to the semaphore.
+ * @return `true` if successful, `false` otherwise.
+ */
+extern wyt_bool_t wyt_evsem_try_acquire(wyt_evsem_t evsem);
+
+/**
+ * @brief Returns the native object backing a Waitable Semaphore.
+ * @details The object is ready (readable, or signaled) while the internal counter is non-zero.
+ * @param[in] evsem [non-null] Handle to the semaphore.
+ * @return
+ * -   Win32: HANDLE of a Semaphore. Waiting on it decrements the counter.
+ * -   Linux: File Descriptor of an eventfd, cast with `(void*)(intptr_t)fd`.
+ * -   MacOS: File Descriptor of the read end of a pipe, cast with `(void*)(intptr_t)fd`.
+ * @warning The object is owned by the semaphore, and must not be closed or read from directly.
+ */
+extern void* wyt_evsem_native(wyt_evsem_t evsem);
+
+/**
+ * @brief Waits until any of several Waitable Semaphores can be decremented, or until a deadline has passed.
+ * @details Exactly one semaphore is decremented on success. Earlier semaphores in the array are preferred when several are ready.
+ * @param[in] evsems [non-null] Array of handles to the semaphores.
+ * @param count The number of elements in `evsems`, from 1 to 64.
+ * @param deadline The timepoint to wait until, based on the same clock as `wyt_nanotime`. May be `WYT_FOREVER`, or 0 to poll.
+ * @return The index of the semaphore that was decremented, or `count` if the deadline passed first.
+ * @note To also wait for a thread to exit, spawn it with `wyt_thread_attr_t::exit_signal` set to one of the semaphores.
+ */
+extern size_t wyt_wait_any(const wyt_evsem_t* evsems, size_t count, wyt_utime_t deadline);
+
+/**
+ * @brief Attempts to create a new bounded Channel.
+ * @details Messages are copied in and out by value, in FIFO order. Any number of threads may send and receive concurrently.
+ *          Senders block while the channel is full, which applies backpressure to faster pipeline stages.
+ * @param capacity [positive] The maximum number of buffered messages. Rounded up to a power of 2, with a minimum of 2.
+ * @param size [positive] The size of each message in bytes.
+ * @return [nullable] NON-NULL handle to the new channel on success, NULL on failure.
+ * @warning If successful, the returned handle must be passed to `wyt_chan_destroy` in order to not leak resources.
+ */
+extern wyt_chan_t wyt_chan_create(size_t capacity, size_t size);
+
+/**
+ * @brief Destroys a Channel. Remaining messages are discarded.
+ * @param chan [non-null] Handle to the channel to destroy.
+ * @warning No threads may be using the channel.
+ */
+extern void wyt_chan_destroy(wyt_chan_t chan);
+
+/**
+ * @brief Closes a Channel, so that no more messages can be sent.
+ * @details Messages that were already sent can still be received. Blocked senders and receivers are woken up.
+ * @param chan [non-null] Handle to the channel.
+ * @note Closing a channel more than once has no further effect.
+ */
+extern void wyt_chan_close(wyt_chan_t chan);
+
+/**
+ * @brief Attempts to send a message, without blocking.
+ * @param chan [non-null] Handle to the channel.
+ * @param[in] message [non-null] The message to send.
+ * @return `wyt_chan_ok` if sent, `wyt_chan_timeout` if the channel was full, or `wyt_chan_closed` if it was closed.
+ */
+extern wyt_chan_result_t wyt_chan_try_send(wyt_chan_t chan, const void* message);
+
+/**
+ * @brief Attempts to receive a message, without blocking.
+ * @param chan [non-null] Handle to the channel.
+ * @param[out] message [non-null] Receives the message.
+ * @return `wyt_chan_ok` if received, `wyt_chan_timeout` if the channel was empty, or `wyt_chan_closed` if it was closed and empty.
+ */
+extern wyt_chan_result_t wyt_chan_try_recv(wyt_chan_t chan, void* message);
+
+/**
+ * @brief Sends a message, blocking while the channel is full.
+ * @param chan [non-null] Handle to the channel.
+ * @param[in] message [non-null] The message to send.
+ * @param deadline The timepoint to wait until, based on the same clock as `wyt_nanotime`. May be `WYT_FOREVER`.
+ * @return `wyt_chan_ok` if sent, `wyt_chan_timeout` if the deadline passed first, or `wyt_chan_closed` if the channel was closed.
+ */
+extern wyt_chan_result_t wyt_chan_send(wyt_chan_t chan, const void* message, wyt_utime_t deadline);
+
+/**
+ * @brief Receives a message, blocking while the channel is empty.
+ * @param chan [non-null] Handle to the channel.
+ * @param[out] message [non-null] Receives the message.
+ * @param deadline The timepoint to wait until, based on the same clock as `wyt_nanotime`. May be `WYT_FOREVER`.
+ * @return `wyt_chan_ok` if received, `wyt_chan_timeout` if the deadline passed first, or `wyt_chan_closed` if the channel was closed and empty.
+ */
+extern wyt_chan_result_t wyt_chan_recv(wyt_chan_t chan, void* message, wyt_utime_t deadline);
+
+/**
+ * @brief Waits until any one of several Channel operations can proceed, and performs it.
+ * @details Exactly one operation is performed on success. Operations on closed channels proceed with `wyt_chan_closed`.
+ *          Ready cases are tried in a rotating order, so that no channel is starved.
+ * @param[in] cases [non-null] Array of the operations to consider.
+ * @param count [positive] The number of elements in `cases`.
+ * @param deadline The timepoint to wait until, based on the same clock as `wyt_nanotime`. May be `WYT_FOREVER`, or 0 to poll.
+ * @param[out] result [nullable] Receives the outcome of the performed operation, or `wyt_chan_timeout`.
+ * @return The index of the performed operation, or `count` if the deadline passed first.
+ */
+extern size_t wyt_select(const wyt_select_case_t* cases, size_t count, wyt_utime_t deadline, wyt_chan_result_t* result);
+
+/**
+ * @brief Attempts to create or open a named Semaphore, which can be shared between processes.
+ * @details Every process that opens the same name refers to the same semaphore. `maximum` and `initial` only apply when it is created.
+ * @param[in] name [non-null] Null-terminated UTF-8 name of the semaphore. Must not contain slashes or backslashes.
+ * @param maximum [positive] The suggested maximum value the internal counter can have.
+ * @param initial [non-negative] The initial value of the internal counter.
+ * @return [nullable] NON-NULL handle to the semaphore on success, NULL on failure.
+ * @warning If successful, the returned handle must be passed to `wyt_sem_destroy` in order to not leak resources.
+ * @note The returned handle can be used with all other `wyt_sem_*` functions.
+ */
+extern wyt_sem_t wyt_sem_open(const char* name, int maximum, int initial);
+
+/**
+ * @brief Removes the name of a named Semaphore, so that later calls to `wyt_sem_open` create a new one.
+ * @details Handles that are already open remain usable.
+ * @param[in] name [non-null] Null-terminated UTF-8 name of the semaphore.
+ * @note On Win32, named objects are removed once every handle is closed, so this function has no effect.
+ */
+extern void wyt_sem_unlink(const char* name);
+
+/**
+ * @brief Attempts to create or open a named Shared Memory segment, and maps it into the current process.
+ * @details A newly created segment is filled with zeroes. Every process must pass the same size.
+ * @param[in] name [non-null] Null-terminated UTF-8 name of the segment. Must not contain slashes or backslashes.
+ * @param size [positive] The size of the segment in bytes.
+ * @return [nullable] NON-NULL handle to the segment on success, NULL on failure (including when an existing segment is too small).
+ * @warning If successful, the returned handle must be passed to `wyt_shm_close` in order to not leak resources.
+ */
+extern wyt_shm_t wyt_shm_open(const char* name, size_t size);
+
+/**
+ * @brief Unmaps a Shared Memory segment from the current process.
+ * @param shm [non-null] Handle to the segment.
+ * @warning After calling this function, the handle and any pointers into the segment are invalid and must not be used.
+ */
+extern void wyt_shm_close(wyt_shm_t shm);
+
+/**
+ * @brief Returns the address a Shared Memory segment is mapped at in the current process.
+ * @param shm [non-null] Handle to the segment.
+ * @return [non-null] Pointer to the first byte of the segment. The segment is aligned to at least a page.
+ * @note Each process may map the segment at a different address, so the segment should not contain pointers into itself.
+ */
+extern void* wyt_shm_data(wyt_shm_t shm);
+
+/**
+ * @brief Returns the size of a Shared Memory segment in bytes.
+ * @param shm [non-null] Handle to the segment.
+ */
+extern size_t wyt_shm_size(wyt_shm_t shm);
+
+/**
+ * @brief Removes the name of a Shared Memory segment, so that later calls to `wyt_shm_open` create a new one.
+ * @details Mappings that are already open remain usable.
+ * @param[in] name [non-null] Null-terminated UTF-8 name of the segment.
+ * @note On Win32, named objects are removed once every handle is closed, so this function has no effect.
+ */
+extern void wyt_shm_unlink(const char* name);
+
+/**
+ * @brief Attempts to create or open a named byte Ring in Shared Memory.
+ * @details Exactly one process (or thread) may write to the ring, and exactly one may read from it.
+ *          Data is written and read in place, without being copied through intermediate buffers.
+ * @param[in] name [non-null] Null-terminated UTF-8 name of the ring. Must not contain slashes or backslashes.
+ * @param capacity [positive] The number of bytes the ring can hold. Rounded up to a power of 2. Every process must pass the same capacity.
+ * @return [nullable] NON-NULL handle to the ring on success, NULL on failure.
+ * @warning If successful, the returned handle must be passed to `wyt_shring_close` in order to not leak resources.
+ * @note The name is also used for a Shared Memory segment, which can be removed with `wyt_shm_unlink`.
+ */
+extern wyt_shring_t wyt_shring_open(const char* name, size_t capacity);
+
+/**
+ * @brief Closes a byte Ring in the current process.
+ * @param ring [non-null] Handle to the ring.
+ * @warning After calling this function, the handle and any pointers into the ring are invalid and must not be used.
+ */
+extern void wyt_shring_close(wyt_shring_t ring);
+
+/**
+ * @brief Returns the contiguous space that can currently be written to a byte Ring.
+ * @details The space may be smaller than the total free space, when it wraps around the end of the ring.
+ * @param ring [non-null] Handle to the ring.
+ * @param[out] ptr [non-null] Receives a pointer to the space.
+ * @return The number of bytes that can be written to `*ptr`, which may be 0.
+ * @warning Must only be called by the producer. The written bytes are only visible after calling `wyt_shring_write_end`.
+ */
+extern size_t wyt_shring_write_begin(wyt_shring_t ring, void** ptr);
+
+/**
+ * @brief Publishes bytes written to the space returned by `wyt_shring_write_begin`.
+ * @param ring [non-null] Handle to the ring.
+ * @param bytes The number of bytes written, no more than the space returned by `wyt_shring_write_begin`.
+ * @warning Must only be called by the producer.
+ */
+extern void wyt_shring_write_end(wyt_shring_t ring, size_t bytes);
+
+/**
+ * @brief Returns the contiguous data that can currently be read from a byte Ring.
+ * @details The data may be smaller than the total readable data, when it wraps around the end of the ring.
+ * @param ring [non-null] Handle to the ring.
+ * @param[out] ptr [non-null] Receives a pointer to the data.
+ * @return The number of bytes that can be read from `*ptr`, which may be 0.
+ * @warning Must only be called by the consumer. The bytes remain valid until released with `wyt_shring_read_end`.
+ */
+extern size_t wyt_shring_read_begin(wyt_shring_t ring, const void** ptr);
+
+/**
+ * @brief Releases bytes read from the data returned by `wyt_shring_read_begin`, so that they can be written again.
+ * @param ring [non-null] Handle to the ring.
+ * @param bytes The number of bytes read, no more than the data returned by `wyt_shring_read_begin`.
+ * @warning Must only be called by the consumer.
+ */
+extern void wyt_shring_read_end(wyt_shring_t ring, size_t bytes);
+
+/**
+ * @brief Waits until at least `bytes` bytes can be written to a byte Ring, or until a deadline has passed.
+ * @param ring [non-null] Handle to the ring.
+ * @param bytes [positive] The number of free bytes to wait for, no more than the capacity of the ring.
+ * @param deadline The timepoint to wait until, based on the same clock as `wyt_nanotime`. May be `WYT_FOREVER`, or 0 to poll.
+ * @return `true` if the space is free, `false` if the deadline passed first.
+ * @warning Must only be called by the producer.
+ * @note The free space may still wrap around the end of the ring.
+ */
+extern wyt_bool_t wyt_shring_wait_write(wyt_shring_t ring, size_t bytes, wyt_utime_t deadline);
+
+/**
+ * @brief Waits until at least `bytes` bytes can be read from a byte Ring, or until a deadline has passed.
+ * @param ring [non-null] Handle to the ring.
+ * @param bytes [positive] The number of readable bytes to wait for, no more than the capacity of the ring.
+ * @param deadline The timepoint to wait until, based on the same clock as `wyt_nanotime`. May be `WYT_FOREVER`, or 0 to poll.
+ * @return `true` if the data is readable, `false` if the deadline passed first.
+ * @warning Must only be called by the consumer.
+ * @note The readable data may still wrap around the end of the ring.
+ */
+extern wyt_bool_t wyt_shring_wait_read(wyt_shring_t ring, size_t bytes, wyt_utime_t deadline);
+
 /**
  * @brief Scales an Unsigned Integer `val` by a Fraction `num / den`.
  * @details Assumes:
@@ -0,0 +1,130 @@
+/**
+ * @file wyt_backend.h
+ * @brief Private interface between the backend-independent parts of Wyt and its backends.
+ *
+ * The Backend Functions are defined by each backend, and are only used by wyt_common.c.
+ * The Common Functions are defined by wyt_common.c, and are only used by the backends.
+ */
+
+#pragma once
+
+#ifndef WYT_BACKEND_H
+#define WYT_BACKEND_H
+
+#include <wyt.h>
+
+// ================================================================================================================================
+//  Backend Functions
+// --------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Attempts to allocate memory.
+ * @details Builds without the C runtime cannot use `malloc`, so the backend decides where memory comes from.
+ * @param size [positive] The number of bytes to allocate.
+ * @return [nullable] NON-NULL pointer to the memory on success, NULL on failure. Suitably aligned for any fundamental type.
+ */
+extern void* wyt_backend_alloc(size_t size);
+
+/**
+ * @brief Attempts to resize memory allocated by `wyt_backend_alloc`, preserving its contents.
+ * @param[in] ptr [nullable] The memory to resize, or NULL to allocate new memory.
+ * @param size [positive] The new size in bytes.
+ * @return [nullable] NON-NULL pointer to the resized memory on success, NULL on failure (in which case `ptr` is unchanged).
+ */
+extern void* wyt_backend_realloc(void* ptr, size_t size);
+
+/**
+ * @brief Frees memory allocated by `wyt_backend_alloc` or `wyt_backend_realloc`.
+ * @param[in] ptr [nullable] The memory to free. Does nothing if NULL.
+ */
+extern void wyt_backend_free(void* ptr);
+
+/**
+ * @brief Queries the size of the pages that `wyt_backend_map` maps memory in.
+ * @return [positive] The page size in bytes.
+ */
+extern size_t wyt_backend_page_size(void);
+
+/**
+ * @brief Attempts to map readable and writable memory directly from the OS.
+ * @param size [positive] The number of bytes to map, which must be a multiple of the page size.
+ * @return [nullable] NON-NULL pointer to the memory on success, NULL on failure. Aligned to the page size.
+ */
+extern void* wyt_backend_map(size_t size);
+
+/**
+ * @brief Unmaps memory mapped by `wyt_backend_map`.
+ * @param[in] ptr [non-null] The memory to unmap.
+ * @param size The number of bytes that were mapped.
+ */
+extern void wyt_backend_unmap(void* ptr, size_t size);
+
+/**
+ * @brief Attempts to open the objects that the two sides of a named byte Ring sleep on while waiting.
+ * @param[in] name [non-null] The name passed to `wyt_shring_open`.
+ * @param[out] readable [non-null] Receives the object the consumer sleeps on. May be NULL if the backend needs none.
+ * @param[out] writable [non-null] Receives the object the producer sleeps on. May be NULL if the backend needs none.
+ * @return `true` on success, `false` on failure.
+ */
+extern wyt_bool_t wyt_backend_shring_open(const char* name, void** readable, void** writable);
+
+/**
+ * @brief Closes the objects opened by `wyt_backend_shring_open`.
+ */
+extern void wyt_backend_shring_close(void* readable, void* writable);
+
+/**
+ * @brief Blocks the current thread until an Event Count in a byte Ring may have been notified by another process.
+ * @param event [nullable] The object the waiting side sleeps on.
+ * @param[in] address [non-null] The Event Count word, with its waiter flag set.
+ * @param key The value of the word after setting the waiter flag.
+ * @param deadline The timepoint to stop waiting at, or `WYT_FOREVER`.
+ * @return `false` if the deadline has passed, `true` otherwise (possibly spuriously).
+ */
+extern wyt_bool_t wyt_backend_shring_wait(void* event, const void* address, wyt_word_t key, wyt_utime_t deadline);
+
+/**
+ * @brief Wakes the thread waiting on an Event Count in a byte Ring, after the word has been advanced.
+ * @param event [nullable] The object the waiting side sleeps on.
+ * @param[in] address [non-null] The Event Count word.
+ */
+extern void wyt_backend_shring_wake(void* event, const void* address);
+
+// ================================================================================================================================
+//  Common Functions
+// --------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Finishes the task of the current thread, if it is a pooled thread that is exiting early.
+ * @details Must be called by `wyt_exit` before the thread exits, as pooled threads never return to the pool afterwards.
+ * @param retval The value passed to `wyt_exit`, which is reported to the task's joiner.
+ */
+extern void wyt_pooled_exit(wyt_retval_t retval);
+
+/**
+ * @brief Implements `wyt_join_until` for handles returned by `wyt_spawn_pooled`.
+ * @param thread [non-null] The tagged handle of the task.
+ * @param deadline The timepoint to stop waiting at, or `WYT_FOREVER`.
+ * @param[out] retval [nullable] Receives the value returned by the task.
+ * @return `true` if the task was joined, `false` if the deadline passed first.
+ */
+extern wyt_bool_t wyt_pooled_join(wyt_thread_t thread, wyt_utime_t deadline, wyt_retval_t* retval);
+
+/**
+ * @brief Implements `wyt_detach` for handles returned by `wyt_spawn_pooled`.
+ * @param thread [non-null] The tagged handle of the task.
+ */
+extern void wyt_pooled_detach(wyt_thread_t thread);
+
+/**
+ * @brief Maps arbitrary keys to dense indices, in order of first occurrence.
+ * @param[in]  keys    [non-null] Array of keys to map.
+ * @param[out] indices [non-null] Array to write the index of each key into.
+ * @param count The number of elements in `keys` and `indices`.
+ * @return The number of distinct keys.
+ */
+extern unsigned int wyt_densify(const unsigned long long* keys, unsigned int* indices, unsigned int count);
+
+// ================================================================================================================================
+
+#endif
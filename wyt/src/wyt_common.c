@@ -0,0 +1,4203 @@
+/**
+ * @file wyt_common.c
+ * @brief Implementation of the backend-independent parts of Wyt.
+ *
+ * Everything in this file is built on top of the public Wyt API and the hooks in wyt_backend.h, so it is shared by all backends.
+ */
+
+#include <wyt.h>
+#include "wyt_backend.h"
+
+#include <limits.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdatomic.h>
+
+#ifdef _VC_NODEFAULTLIB
+    #define WIN32_LEAN_AND_MEAN
+    #include <Windows.h>
+#else
+    #include <stdlib.h>
+#endif
+
+#if (__STDC_VERSION__ <= 201710L)
+    #ifdef true
+        #undef true
+    #endif
+    #ifdef false
+        #undef false
+    #endif
+    #define true ((wyt_bool_t)1)
+    #define false ((wyt_bool_t)0)
+#endif
+
+// ================================================================================================================================
+//  Private Macros
+// --------------------------------------------------------------------------------------------------------------------------------
+
+#ifdef _VC_NODEFAULTLIB
+    /// @see FatalExit | <Windows.h> <winbase.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/winbase/nf-winbase-fatalexit
+    #define WYT_ASSERT(expr) if (expr) {} else FatalExit(1)
+#else
+    /// @see abort | <stdlib.h> [libc] (POSIX.1) | https://en.cppreference.com/w/c/program/abort
+    #define WYT_ASSERT(expr) if (expr) {} else abort()
+#endif
+
+#ifdef NDEBUG
+    #define WYT_ASSUME(expr) ((void)0)
+#else
+    #define WYT_ASSUME(expr) WYT_ASSERT(expr)
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+    /// @see __declspec(thread) | (MSVC) | https://learn.microsoft.com/en-us/cpp/c-language/thread-local-storage
+    #define WYT_THREAD_LOCAL __declspec(thread)
+#else
+    /// @see _Thread_local | (C11) | https://en.cppreference.com/w/c/language/storage_duration
+    #define WYT_THREAD_LOCAL _Thread_local
+#endif
+
+#if defined(__i386__) || defined(__x86_64__)
+    /// @see __builtin_ia32_pause | (GCC) (Clang) | https://gcc.gnu.org/onlinedocs/gcc/x86-Built-in-Functions.html
+    #define WYT_PAUSE() __builtin_ia32_pause()
+#elif defined(__aarch64__) || defined(__arm__)
+    /// @see YIELD | (ARM) | https://developer.arm.com/documentation/dui0802/b/A32-and-T32-Instructions/YIELD
+    #define WYT_PAUSE() __asm__ __volatile__("yield")
+#elif defined(_M_IX86) || defined(_M_X64)
+    /// @see _mm_pause | <immintrin.h> (MSVC) | https://learn.microsoft.com/en-us/cpp/intrinsics/x86-intrinsics-list
+    #include <immintrin.h>
+    #define WYT_PAUSE() _mm_pause()
+#elif defined(_M_ARM) || defined(_M_ARM64)
+    /// @see __yield | <intrin.h> (MSVC) | https://learn.microsoft.com/en-us/cpp/intrinsics/arm64-intrinsics
+    #include <intrin.h>
+    #define WYT_PAUSE() __yield()
+#else
+    #define WYT_PAUSE() ((void)0)
+#endif
+
+/**
+ * @brief Casts a pointer to an atomic word into a pointer that can be passed to `wyt_wait`/`wyt_wake_*`.
+ */
+#define WYT_WORD(ptr) ((const wyt_word_t*)(ptr))
+
+// ================================================================================================================================
+//  Private Declarations
+// --------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief Number of bits of a Barrier's state that count arrived threads. The remaining bits count completed phases.
+ */
+#define WYT_BARRIER_BITS 16u
+
+/**
+ * @brief Mask for the arrival count of a Barrier's state.
+ */
+#define WYT_BARRIER_MASK ((1u << WYT_BARRIER_BITS) - 1u)
+
+/**
+ * @brief Bounds and initial value (in nanoseconds) of the busy-wait margin used by `wyt_precise_sleep_until`.
+ */
+#define WYT_MARGIN_MIN 5000uLL
+#define WYT_MARGIN_MAX 5000000uLL
+#define WYT_MARGIN_INIT 200000uLL
+
+/**
+ * @brief How early the current thread wakes up from the sleeping phase of `wyt_precise_sleep_until`.
+ * @details Kept per thread, because timer slack and scheduling priority (and thus wake-up latency) are per thread.
+ */
+static WYT_THREAD_LOCAL wyt_utime_t wyt_margin = WYT_MARGIN_INIT;
+
+/**
+ * @brief Barrier state.
+ */
+struct wyt_barrier_impl_t
+{
+    _Atomic(wyt_word_t) state; ///< Phase number in the upper bits, arrival count in the lower bits.
+
+    wyt_word_t count; ///< Number of threads that must arrive to complete a phase.
+
+    wyt_barrier_callback_t callback; ///< Completion function to run at the end of each phase.
+    void* userdata; ///< The pointer to pass to `callback`.
+};
+
+/**
+ * @brief Latch state.
+ */
+struct wyt_latch_impl_t
+{
+    _Atomic(wyt_word_t) count; ///< Number of remaining count-downs before the latch opens.
+};
+
+/**
+ * @brief Event Count state.
+ */
+struct wyt_evcount_impl_t
+{
+    _Atomic(wyt_word_t) state; ///< Epoch in the upper bits, with the lowest bit set while there are (potential) waiters.
+};
+
+/**
+ * @brief Number of bytes that keep data written by different threads (or processes) from interfering with each other.
+ * @details Twice the size of a typical cache line, since adjacent-line prefetching pairs up cache lines.
+ */
+#define WYT_PADDING 128u
+
+/**
+ * @brief Single-Producer Single-Consumer Queue state.
+ * @details The indices increase forever (wrapping around), and are masked to find the slot they refer to.
+ */
+struct wyt_spsc_impl_t
+{
+    unsigned char* buffer; ///< Storage for `mask + 1` elements.
+    size_t mask; ///< The capacity of the queue minus 1.
+    size_t size; ///< The size of each element in bytes.
+
+    unsigned char pad0[WYT_PADDING];
+
+    _Atomic(size_t) tail; ///< Index of the next element to be pushed. Only written by the producer.
+    size_t head_cache; ///< The producer's last-seen value of `head`.
+
+    unsigned char pad1[WYT_PADDING];
+
+    _Atomic(size_t) head; ///< Index of the next element to be popped. Only written by the consumer.
+    size_t tail_cache; ///< The consumer's last-seen value of `tail`.
+
+    unsigned char pad2[WYT_PADDING];
+
+    struct wyt_evcount_impl_t readable; ///< Notified by the producer after each push.
+    struct wyt_evcount_impl_t writable; ///< Notified by the consumer after each pop.
+};
+
+/**
+ * @brief Multi-Producer Multi-Consumer Queue state.
+ * @details Based on Dmitry Vyukov's bounded MPMC queue. Each cell starts with a sequence number, followed by the element.
+ *          A cell is ready to be pushed into at index `i` when its sequence is `i`, and ready to be popped from when it is `i + 1`.
+ * @see Bounded MPMC queue | https://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue
+ */
+struct wyt_mpmc_impl_t
+{
+    unsigned char* cells; ///< Storage for `mask + 1` cells.
+    size_t mask; ///< The capacity of the queue minus 1.
+    size_t size; ///< The size of each element in bytes.
+    size_t stride; ///< The size of each cell in bytes.
+
+    unsigned char pad0[WYT_PADDING];
+
+    _Atomic(size_t) tail; ///< Index of the next element to be pushed.
+
+    unsigned char pad1[WYT_PADDING];
+
+    _Atomic(size_t) head; ///< Index of the next element to be popped.
+
+    unsigned char pad2[WYT_PADDING];
+
+    struct wyt_evcount_impl_t readable; ///< Notified after each push.
+    struct wyt_evcount_impl_t writable; ///< Notified after each pop.
+};
+
+/**
+ * @brief Flag set in the shared index of a Triple Buffer when it holds a value the reader has not yet seen.
+ */
+#define WYT_TRIPLE_DIRTY 4u
+
+/**
+ * @brief Triple Buffer state.
+ * @details The three slots are owned by the writer, the reader, and neither (the "middle"). Ownership only changes hands via atomic exchanges of the middle index.
+ */
+struct wyt_triple_buffer_impl_t
+{
+    unsigned char* slots; ///< Storage for three slots, each `stride` bytes apart. Aligned to `WYT_PADDING` bytes.
+    size_t stride; ///< The distance between slots in bytes.
+    void* block; ///< The allocation containing `slots`.
+
+    unsigned char pad0[WYT_PADDING];
+
+    unsigned int back; ///< Index of the writer's slot. Only accessed by the writer.
+
+    unsigned char pad1[WYT_PADDING];
+
+    _Atomic(unsigned int) middle; ///< Index of the middle slot, with `WYT_TRIPLE_DIRTY` set while it is newer than the reader's slot.
+
+    unsigned char pad2[WYT_PADDING];
+
+    unsigned int front; ///< Index of the reader's slot. Only accessed by the reader.
+};
+
+/**
+ * @brief Sequence Lock state.
+ * @details The value is stored in atomic words which are accessed with relaxed ordering, so concurrent reads and writes are not data races.
+ * @see Can Seqlocks Get Along with Programming Language Memory Models? | https://www.hpl.hp.com/techreports/2012/HPL-2012-68.pdf
+ */
+struct wyt_seqlock_impl_t
+{
+    _Atomic(size_t) seq; ///< Incremented before and after each write, so it is odd while a write is in progress.
+    size_t size; ///< The size of the value in bytes.
+    _Atomic(size_t) words[]; ///< The value, padded to a whole number of words.
+};
+
+/**
+ * @brief Number of retired objects held by each chunk of an Epoch-Based Reclamation domain.
+ */
+#define WYT_EBR_CHUNK 64u
+
+/**
+ * @brief Maximum number of empty chunks each registered thread keeps for reuse.
+ */
+#define WYT_EBR_SPARES 2u
+
+/**
+ * @brief A batch of retired objects.
+ */
+struct wyt_ebr_chunk_t
+{
+    struct wyt_ebr_chunk_t* next; ///< The next (younger) chunk in the same list.
+    size_t epoch; ///< The global epoch observed when the chunk was sealed.
+    size_t count; ///< The number of retired objects in the chunk.
+    struct { void* ptr; wyt_ebr_reclaim_t reclaim; } items[WYT_EBR_CHUNK]; ///< The retired objects.
+};
+
+/**
+ * @brief Epoch-Based Reclamation state of a registered Thread.
+ */
+struct wyt_ebr_record_t
+{
+    _Atomic(size_t) local; ///< `(epoch << 1) | 1` while in a critical section, or 0 otherwise.
+
+    unsigned char pad0[WYT_PADDING];
+
+    struct wyt_ebr_impl_t* domain; ///< The domain the thread is registered with.
+    struct wyt_ebr_record_t* next; ///< The next registered thread.
+
+    unsigned int depth; ///< Nesting depth of critical sections.
+    size_t pending; ///< Number of retired objects that have not been reclaimed.
+
+    struct wyt_ebr_chunk_t* bag; ///< The chunk being filled, which has not been sealed yet.
+    struct wyt_ebr_chunk_t* oldest; ///< The oldest sealed chunk, waiting to be reclaimed.
+    struct wyt_ebr_chunk_t* youngest; ///< The youngest sealed chunk, waiting to be reclaimed.
+
+    struct wyt_ebr_chunk_t* spare; ///< Empty chunks kept for reuse.
+    size_t spares; ///< The number of chunks in `spare`.
+};
+
+/**
+ * @brief Epoch-Based Reclamation domain state.
+ * @details Objects sealed in epoch `E` were unlinked before any thread announced epoch `E + 1`, so they can be reclaimed once the global epoch reaches `E + 2`.
+ *          The global epoch only advances when every thread in a critical section has announced the current epoch.
+ */
+struct wyt_ebr_impl_t
+{
+    _Atomic(size_t) epoch; ///< The global epoch.
+
+    unsigned char pad0[WYT_PADDING];
+
+    _Atomic(wyt_word_t) lock; ///< Protects `records` and `orphans`.
+    struct wyt_ebr_record_t* records; ///< The registered threads.
+    struct wyt_ebr_chunk_t* orphans; ///< Sealed chunks left behind by unregistered threads.
+
+    size_t backlog; ///< Number of pending objects per thread that triggers blocking reclamation.
+};
+
+/**
+ * @brief Number of nanoseconds a thread sleeps for while all of its scheduled fibers are waiting on different words.
+ */
+#define WYT_FIBER_POLL 100000uLL
+
+/**
+ * @brief A fiber scheduled on a thread.
+ */
+struct wyt_fiber_task_t
+{
+    wyt_fiber_t fiber; ///< The fiber running the task.
+    wyt_fiber_entry_t func; ///< The user's entry-function.
+    void* arg; ///< The argument to pass to `func`.
+    struct wyt_fiber_task_t* next; ///< The next task in the run queue.
+    wyt_bool_t done; ///< Whether `func` has returned.
+};
+
+/**
+ * @brief Per-thread Fiber scheduler state.
+ */
+struct wyt_fiber_sched_t
+{
+    struct wyt_fiber_task_t* head; ///< The first task in the run queue.
+    struct wyt_fiber_task_t* tail; ///< The last task in the run queue.
+    struct wyt_fiber_task_t* running; ///< The running task, or NULL outside of scheduled fibers.
+    wyt_fiber_t home; ///< The fiber running `wyt_fiber_run`.
+    size_t ready; ///< The number of tasks in the run queue.
+    size_t waiting; ///< The number of tasks inside `wyt_fiber_wait`.
+};
+
+/**
+ * @brief The Fiber Scheduler of the current thread.
+ */
+static WYT_THREAD_LOCAL struct wyt_fiber_sched_t wyt_fiber_sched;
+
+/**
+ * @brief A unit of work queued on a Worker Pool.
+ */
+struct wyt_work_t
+{
+    wyt_work_callback_t func; ///< The function to run, or NULL to stop the worker that pops it.
+    void* userdata; ///< The argument to pass to `func`.
+};
+
+/**
+ * @brief Implementation of a Worker Pool.
+ */
+struct wyt_workers_impl_t
+{
+    wyt_mpmc_t queue; ///< The queue of `wyt_work_t` waiting to run.
+    unsigned int count; ///< The number of worker threads.
+    wyt_thread_t threads[]; ///< The worker threads.
+};
+
+/**
+ * @brief The Worker Pool the current thread belongs to, if any.
+ */
+static WYT_THREAD_LOCAL struct wyt_workers_impl_t* wyt_workers_self;
+
+/**
+ * @brief A Node of a Task Graph.
+ */
+struct wyt_graph_node_impl_t
+{
+    wyt_work_callback_t func; ///< The function to run.
+    void* userdata; ///< The argument to pass to `func`.
+    struct wyt_graph_impl_t* graph; ///< The graph the node belongs to.
+    unsigned int* successors; ///< Indices of the nodes that depend on this one.
+    unsigned int successor_count; ///< The number of elements in `successors`.
+    unsigned int successor_capacity; ///< The allocated number of elements in `successors`.
+    unsigned int dependencies; ///< The number of nodes this one depends on.
+    _Atomic(wyt_word_t) pending; ///< The number of dependencies that have not finished yet during the current run.
+};
+
+/**
+ * @brief Implementation of a Task Graph.
+ */
+struct wyt_graph_impl_t
+{
+    struct wyt_workers_impl_t* workers; ///< The worker pool to run nodes on.
+    struct wyt_graph_node_impl_t* nodes; ///< The nodes of the graph.
+    unsigned int count; ///< The number of elements in `nodes`.
+    unsigned int capacity; ///< The allocated number of elements in `nodes`.
+    _Atomic(wyt_word_t) remaining; ///< The number of nodes that have not finished yet during the current run.
+};
+
+/**
+ * @brief States of a Future.
+ */
+#define WYT_FUTURE_PENDING 0u
+#define WYT_FUTURE_READY 1u
+#define WYT_FUTURE_SLEEPING 2u
+
+/**
+ * @brief Value of the dependents list of a Future once it has completed, after which continuations are dispatched immediately.
+ */
+#define WYT_FUTURE_DONE ((uintptr_t)1)
+
+/**
+ * @brief Number of shared states allocated at once when the pool of Futures is empty.
+ */
+#define WYT_FUTURE_SLAB 64u
+
+/**
+ * @brief Shared state of a Future.
+ * @details States are carved from slabs and recycled through a free list, which keeps them for the lifetime of the process.
+ */
+struct wyt_future_impl_t
+{
+    _Atomic(wyt_word_t) refs; ///< The number of references to the future, including one held by its pending continuation.
+    _Atomic(wyt_word_t) state; ///< One of `WYT_FUTURE_PENDING`, `WYT_FUTURE_READY`, or `WYT_FUTURE_SLEEPING`.
+    _Atomic(uintptr_t) dependents; ///< The continuations waiting for this future, or `WYT_FUTURE_DONE`.
+    void* value; ///< The value the future completed with.
+
+    struct wyt_future_impl_t* next; ///< The next continuation of the same future, or the next state in the free list.
+    wyt_future_callback_t func; ///< The continuation that completes this future, or NULL.
+    void* userdata; ///< The first argument to pass to `func`.
+    wyt_workers_t workers; ///< The worker pool to run `func` on, or NULL.
+    void* input; ///< The value of the future being continued from.
+};
+
+static _Atomic(wyt_word_t) wyt_future_lock; ///< Protects `wyt_future_pool`.
+static struct wyt_future_impl_t* wyt_future_pool; ///< The free list of shared states.
+
+/**
+ * @brief Acquires an internal lock, sleeping via `wyt_wait` while it is contended.
+ * @details The lock word is 0 when unlocked, 1 when locked, and 2 when locked with (potential) sleepers.
+ * @param[in,out] lock [non-null] The lock word.
+ */
+static void wyt_lock_acquire(_Atomic(wyt_word_t)* lock);
+
+/**
+ * @brief Releases an internal lock acquired by `wyt_lock_acquire`.
+ * @param[in,out] lock [non-null] The lock word.
+ */
+static void wyt_lock_release(_Atomic(wyt_word_t)* lock);
+
+/**
+ * @brief Number of levels of a Timer Wheel, and the number of bits of the tick count covered by each level.
+ */
+#define WYT_WHEEL_LEVELS 4u
+#define WYT_WHEEL_BITS 8u
+
+/**
+ * @brief Number of slots in each level of a Timer Wheel.
+ */
+#define WYT_WHEEL_SIZE (1u << WYT_WHEEL_BITS)
+
+/**
+ * @brief Index of the slot holding timers too far in the future for any level of a Timer Wheel.
+ */
+#define WYT_WHEEL_OVERFLOW (WYT_WHEEL_LEVELS * WYT_WHEEL_SIZE)
+
+/**
+ * @brief Sentinel values for node indices and node slots of a Timer Wheel.
+ */
+#define WYT_WHEEL_NONE UINT32_MAX
+#define WYT_WHEEL_FIRING (UINT32_MAX - 1u)
+
+/**
+ * @brief Maximum number of expired timers a Timer Wheel dequeues per lock acquisition.
+ */
+#define WYT_WHEEL_BATCH 64u
+
+/**
+ * @brief A Timer, as stored in the node pool of a Timer Wheel.
+ */
+struct wyt_wheel_node_t
+{
+    wyt_utime_t tick; ///< The tick at which the timer expires.
+    wyt_timer_callback_t callback; ///< The function to call when the timer expires.
+    void* userdata; ///< The pointer to pass to `callback`.
+    uint32_t prev; ///< Index of the previous node in the same slot, or `WYT_WHEEL_NONE`.
+    uint32_t next; ///< Index of the next node in the same slot (or list), or `WYT_WHEEL_NONE`.
+    uint32_t slot; ///< Index of the slot holding the node, `WYT_WHEEL_FIRING`, or `WYT_WHEEL_NONE` if free.
+    uint32_t gen; ///< Generation of the node, incremented whenever its handle becomes stale.
+};
+
+/**
+ * @brief Timer Wheel state.
+ */
+struct wyt_wheel_impl_t
+{
+    _Atomic(wyt_word_t) lock; ///< Protects every other member.
+    _Atomic(wyt_word_t) signal; ///< Bumped to wake up the driver thread early.
+
+    wyt_utime_t resolution; ///< Nanoseconds per tick.
+    wyt_utime_t current; ///< The next tick to be processed.
+    wyt_utime_t wake; ///< The tick the driver thread is sleeping until, or `WYT_FOREVER`.
+
+    struct wyt_wheel_node_t* nodes; ///< Pool of nodes, addressed by index.
+    uint32_t capacity; ///< Number of elements in `nodes`.
+    uint32_t used; ///< Number of elements of `nodes` that have ever been handed out.
+    uint32_t free; ///< Head of the list of free nodes.
+    uint32_t fired; ///< Head of the list of expired nodes whose callbacks are yet to be called.
+
+    uint32_t counts[WYT_WHEEL_LEVELS + 1]; ///< Number of nodes in each level (and the overflow slot).
+    uint32_t heads[WYT_WHEEL_OVERFLOW + 1]; ///< Head of the list of nodes in each slot.
+
+    wyt_thread_t driver; ///< The driver thread.
+    wyt_bool_t running; ///< Whether the driver thread is running.
+};
+
+/**
+ * @brief Takes a node from the free list, or grows the node pool if there are none.
+ * @param[in,out] self [non-null] The timer wheel.
+ * @return The index of the node, or `WYT_WHEEL_NONE` on failure.
+ */
+static uint32_t wyt_wheel_alloc(struct wyt_wheel_impl_t* self);
+
+/**
+ * @brief Returns a node whose handle has become stale to the free list.
+ * @details Nodes whose generation has wrapped around are retired instead, so that handles are never reused.
+ * @param[in,out] self [non-null] The timer wheel.
+ * @param index The index of the node to free.
+ */
+static void wyt_wheel_free(struct wyt_wheel_impl_t* self, uint32_t index);
+
+/**
+ * @brief Links a node into the slot matching its tick, relative to the wheel's current tick.
+ * @param[in,out] self [non-null] The timer wheel.
+ * @param index The index of the node to link.
+ */
+static void wyt_wheel_link(struct wyt_wheel_impl_t* self, uint32_t index);
+
+/**
+ * @brief Unlinks a node from its slot.
+ * @param[in,out] self [non-null] The timer wheel.
+ * @param index The index of the node to unlink.
+ */
+static void wyt_wheel_unlink(struct wyt_wheel_impl_t* self, uint32_t index);
+
+/**
+ * @brief Re-links every node of a slot, moving them to lower levels.
+ * @param[in,out] self [non-null] The timer wheel.
+ * @param slot The index of the slot to cascade.
+ */
+static void wyt_wheel_cascade(struct wyt_wheel_impl_t* self, uint32_t slot);
+
+/**
+ * @brief Finds the earliest tick at which `wyt_wheel_advance` would have any work to do.
+ * @param[in] self [non-null] The timer wheel.
+ * @return The tick, or `WYT_FOREVER` if the wheel is empty.
+ */
+static wyt_utime_t wyt_wheel_next(const struct wyt_wheel_impl_t* self);
+
+/**
+ * @brief Entry-function of the driver thread of a Timer Wheel.
+ * @param[in] arg [non-null] The timer wheel.
+ */
+static wyt_retval_t WYT_ENTRY wyt_wheel_drive(void* arg);
+
+/**
+ * @brief Reclaims every object in a chunk.
+ * @param[in] chunk [non-null] The chunk to reclaim.
+ */
+static void wyt_ebr_reclaim_chunk(const struct wyt_ebr_chunk_t* chunk);
+
+/**
+ * @brief Attempts to advance the global epoch, and reclaims orphaned chunks that have become safe.
+ * @param[in,out] self [non-null] The domain.
+ * @return `true` if the epoch could be advanced, `false` if a thread is still in a critical section of an older epoch.
+ */
+static wyt_bool_t wyt_ebr_advance(struct wyt_ebr_impl_t* self);
+
+/**
+ * @brief Seals the bag of a thread, tagging it with the current global epoch.
+ * @param[in,out] rec [non-null] The thread's record.
+ */
+static void wyt_ebr_seal(struct wyt_ebr_record_t* rec);
+
+/**
+ * @brief Reclaims the sealed chunks of a thread that have become safe.
+ * @param[in,out] rec [non-null] The thread's record.
+ */
+static void wyt_ebr_collect(struct wyt_ebr_record_t* rec);
+
+/**
+ * @brief Blocks until the number of pending objects of a thread is at most `goal`.
+ * @param[in,out] rec [non-null] The thread's record, which must not be in a critical section.
+ * @param goal The number of pending objects to reduce to.
+ */
+static void wyt_ebr_drain(struct wyt_ebr_record_t* rec, size_t goal);
+
+/**
+ * @brief Appends a task to the current thread's run queue.
+ * @param[in] task [non-null] The task to append.
+ */
+static void wyt_fiber_enqueue(struct wyt_fiber_task_t* task);
+
+/**
+ * @brief Entry-function of scheduled fibers.
+ * @param[in] arg [non-null] The task to run.
+ */
+static void wyt_fiber_main(void* arg);
+
+/**
+ * @brief Entry-function of the threads of a Worker Pool.
+ * @param[in] arg [non-null] The worker pool.
+ */
+static wyt_retval_t WYT_ENTRY wyt_workers_main(void* arg);
+
+/**
+ * @brief Runs a node of a Task Graph, followed by dependent nodes that it makes ready.
+ * @param[in] arg [non-null] The node to run.
+ */
+static void wyt_graph_exec(void* arg);
+
+/**
+ * @brief Takes a shared state from the pool of Futures, and initializes it as pending with `refs` references.
+ * @param refs The initial number of references.
+ * @return [nullable] The shared state, or NULL on failure.
+ */
+static struct wyt_future_impl_t* wyt_future_alloc(wyt_word_t refs);
+
+/**
+ * @brief Completes a Future, wakes its waiters, and dispatches its continuations.
+ * @details Continuations without a worker pool are pushed onto `pending` rather than run, so that long chains do not recurse.
+ * @param[in,out] self [non-null] The future.
+ * @param value [nullable] The value to complete the future with.
+ * @param[in,out] pending [non-null] The list of continuations to run inline, linked through `next`.
+ */
+static void wyt_future_settle(struct wyt_future_impl_t* self, void* value, struct wyt_future_impl_t** pending);
+
+/**
+ * @brief Runs a list of continuations inline, along with any further inline continuations they complete.
+ * @param[in] pending [nullable] The list of continuations to run, linked through `next`.
+ */
+static void wyt_future_run(struct wyt_future_impl_t* pending);
+
+/**
+ * @brief Runs the continuation of a Future inline, or submits it to its worker pool.
+ * @param[in] self [non-null] The future produced by the continuation.
+ */
+static void wyt_future_dispatch(struct wyt_future_impl_t* self);
+
+/**
+ * @brief Runs the continuation of a Future, then completes it.
+ * @param[in] arg [non-null] The future produced by the continuation.
+ */
+static void wyt_future_continue(void* arg);
+
+/**
+ * @brief Maximum number of pools that have per-thread caches at the same time.
+ */
+#define WYT_POOL_CACHES 16u
+
+/**
+ * @brief Maximum number of objects in a thread's cache for a single pool.
+ */
+#define WYT_POOL_CACHE_MAX 64u
+
+/**
+ * @brief Number of objects moved between a thread's cache and the shared free list at once.
+ */
+#define WYT_POOL_BATCH 32u
+
+/**
+ * @brief Number of allocations after which a thread adds its counts to the statistics of a pool.
+ */
+#define WYT_POOL_TALLY 4096u
+
+/**
+ * @brief Number of objects in the first slab of a pool.
+ */
+#define WYT_POOL_SLAB 64u
+
+/**
+ * @brief Maximum number of slabs of a pool, which keeps every object index within 32 bits.
+ */
+#define WYT_POOL_SLABS 26u
+
+/**
+ * @brief A thread's cache of free objects for the pool using the same slot.
+ * @details Cached objects are linked through their first pointer-sized bytes.
+ */
+struct wyt_pool_cache_t
+{
+    unsigned long long id; ///< The unique ID of the pool the cache belongs to. Stale IDs belong to destroyed pools.
+    void* head; ///< The most recently freed object, or NULL.
+    unsigned int count; ///< The number of cached objects.
+    unsigned int allocs; ///< Allocations not yet added to the pool's statistics.
+    unsigned int hits; ///< Cache hits not yet added to the pool's statistics.
+};
+
+/**
+ * @brief Pool state.
+ * @details Objects live in slabs which double in size, and are identified by their index across all slabs.
+ *          The shared free list is a Treiber stack whose head packs the index (plus 1) of the top object with a tag in the upper 32 bits,
+ *          which changes on every update to prevent the ABA problem. Objects in the list store the index (plus 1) of the next one.
+ */
+struct wyt_pool_impl_t
+{
+    size_t size; ///< The size of each object in bytes.
+    size_t align; ///< The alignment of each object in bytes.
+    size_t stride; ///< The distance between objects in bytes.
+    unsigned long long id; ///< The unique ID of the pool.
+    unsigned int slot; ///< The index of the pool's cache in each thread, or `WYT_POOL_CACHES` if it has none.
+
+    unsigned char pad0[WYT_PADDING];
+
+    _Atomic(uint64_t) head; ///< The top of the shared free list.
+
+    unsigned char pad1[WYT_PADDING];
+
+    _Atomic(wyt_word_t) lock; ///< Serializes growth.
+    _Atomic(unsigned int) slab_count; ///< The number of slabs, published after each slab is initialized.
+    unsigned char* slabs[WYT_POOL_SLABS]; ///< The first object of each slab.
+    void* blocks[WYT_POOL_SLABS]; ///< The allocation of each slab.
+
+    _Atomic(size_t) allocs; ///< See `wyt_pool_stats_t::allocs`.
+    _Atomic(size_t) cache_hits; ///< See `wyt_pool_stats_t::cache_hits`.
+    _Atomic(size_t) global_hits; ///< See `wyt_pool_stats_t::global_hits`.
+};
+
+static _Atomic(wyt_word_t) wyt_pool_lock; ///< Protects `wyt_pool_slots` and `wyt_pool_ids`.
+static unsigned int wyt_pool_slots; ///< Bitmask of the cache slots in use by pools.
+static unsigned long long wyt_pool_ids; ///< The last ID given to a pool.
+static struct wyt_pool_impl_t* wyt_pool_live[WYT_POOL_CACHES]; ///< The pool using each cache slot, or NULL. Protected by `wyt_pool_lock`.
+static wyt_tls_t wyt_pool_key; ///< Key whose destructor flushes the caches of exiting threads. Created on first use, protected by `wyt_pool_lock`.
+static WYT_THREAD_LOCAL struct wyt_pool_cache_t wyt_pool_caches[WYT_POOL_CACHES]; ///< The current thread's cache of each pool, indexed by cache slot.
+
+/**
+ * @brief Returns the object of a pool with the given index.
+ */
+static unsigned char* wyt_pool_object(const struct wyt_pool_impl_t* self, uint32_t index);
+
+/**
+ * @brief Returns the index of an object of a pool.
+ */
+static uint32_t wyt_pool_index(const struct wyt_pool_impl_t* self, const void* ptr);
+
+/**
+ * @brief Pushes objects onto the shared free list of a pool.
+ * @param[in,out] self [non-null] The pool.
+ * @param[in] first The index (plus 1) of the first object, whose links to the rest of the objects are already stored.
+ * @param[in,out] last [non-null] The last object, whose link is set to the previous top of the list.
+ */
+static void wyt_pool_push(struct wyt_pool_impl_t* self, uint32_t first, unsigned char* last);
+
+/**
+ * @brief Pops an object from the shared free list of a pool.
+ * @return [nullable] The object, or NULL if the list was empty.
+ */
+static void* wyt_pool_pop(struct wyt_pool_impl_t* self);
+
+/**
+ * @brief Allocates a new slab for a pool and pushes its objects onto the shared free list, unless another thread already did.
+ * @return Whether the shared free list may have objects to pop.
+ */
+static wyt_bool_t wyt_pool_grow(struct wyt_pool_impl_t* self);
+
+/**
+ * @brief Moves `count` objects from a thread's cache to the shared free list of its pool.
+ * @param count [positive] The number of objects to move, no more than the cache holds.
+ */
+static void wyt_pool_flush(struct wyt_pool_impl_t* self, struct wyt_pool_cache_t* cache, unsigned int count);
+
+/**
+ * @brief Adds the counts of a thread's cache to the statistics of its pool.
+ */
+static void wyt_pool_tally(struct wyt_pool_impl_t* self, struct wyt_pool_cache_t* cache);
+
+/**
+ * @brief Returns the current thread's cache for a pool, resetting it if it belonged to a destroyed pool.
+ * @return [nullable] The cache, or NULL if the pool has no caches, or the thread's caches could not be registered for flushing.
+ */
+static struct wyt_pool_cache_t* wyt_pool_cache(struct wyt_pool_impl_t* self);
+
+/**
+ * @brief Thread-Local Storage destructor that flushes an exiting thread's caches back to the shared free lists of their pools.
+ * @param[in] value [non-null] The caches of the thread.
+ */
+static void wyt_pool_exit(void* value);
+
+/**
+ * @brief Bit of the state of a Channel that is set once the channel is closed.
+ */
+#define WYT_CHAN_CLOSED 1u
+
+/**
+ * @brief Channel state.
+ * @details Messages are buffered in a Multi-Producer Multi-Consumer Queue, whose Event Counts also wake blocked senders and receivers.
+ */
+struct wyt_chan_impl_t
+{
+    wyt_mpmc_t queue; ///< The buffered messages.
+
+    unsigned char pad0[WYT_PADDING];
+
+    _Atomic(size_t) state; ///< `WYT_CHAN_CLOSED`, plus 2 for every send in progress.
+    _Atomic(size_t) selectors; ///< Number of `wyt_select` calls waiting on the channel.
+};
+
+/**
+ * @brief Notified by operations on any channel with waiting `wyt_select` calls.
+ * @details Shared by all channels, so that a select call only needs to wait on a single word.
+ */
+static struct wyt_evcount_impl_t wyt_select_evcount;
+
+/**
+ * @brief The case each `wyt_select` call of a thread tries first, which rotates to prevent starvation.
+ */
+static WYT_THREAD_LOCAL size_t wyt_select_turn;
+
+/**
+ * @brief Wakes the `wyt_select` calls waiting on a channel, if any.
+ * @details Must only be called after notifying one of the channel's Event Counts.
+ * @param[in] self [non-null] The channel.
+ */
+static void wyt_chan_changed(struct wyt_chan_impl_t* self);
+
+/**
+ * @brief Attempts each operation of a `wyt_select` call once, in a rotating order.
+ * @param[in]  cases [non-null] The operations.
+ * @param      count The number of elements in `cases`.
+ * @param      start The index of the operation to try first.
+ * @param[out] index [non-null] Receives the index of the performed operation, if any.
+ * @return The outcome of the performed operation, or `wyt_chan_timeout` if none could proceed.
+ */
+static wyt_chan_result_t wyt_select_try(const wyt_select_case_t* cases, size_t count, size_t start, size_t* index);
+
+/**
+ * @brief Number of nanoseconds a pooled thread stays parked without work before it exits.
+ */
+#define WYT_POOLED_IDLE 10000000000uLL
+
+/**
+ * @brief Maximum number of parked pooled threads.
+ */
+#define WYT_POOLED_MAX 64u
+
+/**
+ * @brief Flags in the state of a Pooled Task.
+ */
+#define WYT_POOLED_DONE 1u
+#define WYT_POOLED_DETACHED 2u
+#define WYT_POOLED_JOINING 4u
+
+/**
+ * @brief A function run by `wyt_spawn_pooled`. Handles to it are tagged with the lowest bit, which is clear in every native thread handle.
+ */
+struct wyt_task_t
+{
+    wyt_entry_t func;     ///< The user's entry-function.
+    void* arg;            ///< The argument to pass to `func`.
+    wyt_retval_t retval;  ///< The value returned by `func`, or passed to `wyt_exit`.
+    wyt_word_t state;     ///< The `WYT_POOLED_*` flags, protected by `wyt_pooled_lock`.
+};
+
+/**
+ * @brief A thread of the pool used by `wyt_spawn_pooled`.
+ */
+struct wyt_pooled_t
+{
+    struct wyt_pooled_t* next; ///< The next parked thread.
+    struct wyt_task_t* task;   ///< The task to run, or NULL while parked.
+    wyt_word_t signal;         ///< Set to 1 when a task is assigned, protected by `wyt_pooled_lock`.
+};
+
+static _Atomic(wyt_word_t) wyt_pooled_lock; ///< Protects the idle list and the state of every Pooled Task.
+static struct wyt_pooled_t* wyt_pooled_idle; ///< The parked threads, most recently parked first.
+static unsigned int wyt_pooled_parked; ///< The number of threads in `wyt_pooled_idle`.
+
+/**
+ * @brief The pooled thread running on the current thread, while it runs a task.
+ */
+static WYT_THREAD_LOCAL struct wyt_pooled_t* wyt_pooled_self;
+
+/**
+ * @brief Entry-function of pooled threads.
+ * @param[in] ptr [non-null] The `wyt_pooled_t` of the thread, which is freed by the thread when it exits.
+ */
+static wyt_retval_t WYT_ENTRY wyt_pooled_main(void* ptr);
+
+/**
+ * @brief Marks a pooled task as done, freeing it if detached or waking its joiner otherwise.
+ * @param[in,out] task [non-null] The task. `wyt_pooled_lock` must be held.
+ */
+static void wyt_pooled_finish(struct wyt_task_t* task);
+
+/**
+ * @brief Default size of an arena's chunks, in bytes.
+ */
+#define WYT_ARENA_CHUNK_DEFAULT ((size_t)1024 * 1024)
+
+/**
+ * @brief Header of each memory mapping owned by an Arena. The usable memory follows it.
+ */
+struct wyt_arena_chunk_t
+{
+    struct wyt_arena_chunk_t* next; ///< The next chunk, which is unused if this chunk is the current one.
+    unsigned char* end;             ///< The end of the mapping.
+};
+
+/**
+ * @brief Implementation of an Arena.
+ * @details Stored after the header of its first chunk.
+ */
+struct wyt_arena_impl_t
+{
+    struct wyt_arena_chunk_t* first;   ///< The chunk containing the arena itself.
+    struct wyt_arena_chunk_t* current; ///< The chunk being allocated from.
+    unsigned char* position;           ///< The next free byte of `current`.
+    unsigned char* limit;              ///< The end of `current`.
+    size_t chunk_size;                 ///< The size of regular chunks, rounded up to the page size.
+    size_t page;                       ///< The page size.
+};
+
+/**
+ * @brief Attempts to map a new chunk for an arena.
+ * @param[in] size The size of the mapping, which must be a multiple of the page size.
+ * @return [nullable] The new chunk, not yet linked into an arena.
+ */
+static struct wyt_arena_chunk_t* wyt_arena_map(size_t size);
+
+/**
+ * @brief Slow-path of `wyt_arena_alloc`. Moves on to the next chunk, mapping it if needed, and allocates from it.
+ */
+static void* wyt_arena_grow(struct wyt_arena_impl_t* self, size_t size, size_t align);
+
+/**
+ * @brief Header of a byte Ring, stored at the start of its Shared Memory segment.
+ * @details A zero-filled header is a valid empty ring, so that newly created segments need no further initialization.
+ *          The positions increase forever, and are masked to find the byte they refer to.
+ */
+struct wyt_shring_header_t
+{
+    _Atomic(unsigned long long) capacity; ///< The capacity of the ring, set by the first process to open it.
+
+    unsigned char pad0[WYT_PADDING];
+
+    _Atomic(unsigned long long) tail; ///< Position of the next byte to be written. Only written by the producer.
+    _Atomic(wyt_word_t) readable;     ///< Event Count notified by the producer after each write.
+
+    unsigned char pad1[WYT_PADDING];
+
+    _Atomic(unsigned long long) head; ///< Position of the next byte to be read. Only written by the consumer.
+    _Atomic(wyt_word_t) writable;     ///< Event Count notified by the consumer after each read.
+
+    unsigned char pad2[WYT_PADDING];
+};
+
+/**
+ * @brief Offset of the data of a byte Ring from the start of its Shared Memory segment.
+ */
+#define WYT_SHRING_OFFSET (((sizeof(struct wyt_shring_header_t) + WYT_PADDING - 1u) / WYT_PADDING) * WYT_PADDING)
+
+/**
+ * @brief Implementation of an open byte Ring.
+ */
+struct wyt_shring_impl_t
+{
+    wyt_shm_t shm;                      ///< The segment holding the ring.
+    struct wyt_shring_header_t* header; ///< The header at the start of the segment.
+    unsigned char* data;                ///< Storage for `mask + 1` bytes.
+    size_t mask;                        ///< The capacity of the ring minus 1.
+    void* readable;                     ///< The object the consumer sleeps on, opened by `wyt_backend_shring_open`.
+    void* writable;                     ///< The object the producer sleeps on, opened by `wyt_backend_shring_open`.
+};
+
+/**
+ * @brief Notifies the process waiting on an Event Count in a byte Ring.
+ * @param event [nullable] The object the waiting side sleeps on.
+ * @see wyt_evcount_notify
+ */
+static void wyt_shring_notify(_Atomic(wyt_word_t)* state, void* event);
+
+/**
+ * @brief Returns the number of bytes that can currently be written to (`writer`) or read from (`!writer`) a byte Ring.
+ */
+static size_t wyt_shring_available(const struct wyt_shring_impl_t* self, wyt_bool_t writer);
+
+/**
+ * @brief Waits until at least `bytes` bytes can be written to (`writer`) or read from (`!writer`) a byte Ring.
+ * @see wyt_shring_wait_write
+ * @see wyt_shring_wait_read
+ */
+static wyt_bool_t wyt_shring_wait(const struct wyt_shring_impl_t* self, wyt_bool_t writer, size_t bytes, wyt_utime_t deadline);
+
+// ================================================================================================================================
+//  Private Definitions
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static void wyt_lock_acquire(_Atomic(wyt_word_t)* const lock)
+{
+    wyt_word_t expected = 0;
+    /// @see atomic_compare_exchange_strong_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_compare_exchange
+    if (atomic_compare_exchange_strong_explicit(lock, &expected, 1, memory_order_acquire, memory_order_relaxed)) return;
+
+    // Once contended, the lock stays marked as contended until released, so the releasing thread knows to wake up a sleeper.
+    /// @see atomic_exchange_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_exchange
+    while (atomic_exchange_explicit(lock, 2, memory_order_acquire) != 0)
+    {
+        (void)wyt_wait(WYT_WORD(lock), 2, WYT_FOREVER);
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static void wyt_lock_release(_Atomic(wyt_word_t)* const lock)
+{
+    /// @see atomic_exchange_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_exchange
+    if (atomic_exchange_explicit(lock, 0, memory_order_release) == 2) wyt_wake_one(WYT_WORD(lock));
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static uint32_t wyt_wheel_alloc(struct wyt_wheel_impl_t* const self)
+{
+    const uint32_t index = self->free;
+    if (index != WYT_WHEEL_NONE)
+    {
+        self->free = self->nodes[index].next;
+        return index;
+    }
+
+    if (self->used == self->capacity)
+    {
+        // Handles are formed from `index + 1`, and the largest indices double as sentinels.
+        const uint32_t capacity = (self->capacity == 0) ? 64u : (self->capacity * 2u);
+        if ((capacity <= self->capacity) || (capacity >= WYT_WHEEL_FIRING)) return WYT_WHEEL_NONE;
+        struct wyt_wheel_node_t* const nodes = wyt_backend_realloc(self->nodes, sizeof(struct wyt_wheel_node_t) * capacity);
+        if (nodes == NULL) return WYT_WHEEL_NONE;
+
+        self->nodes = nodes;
+        self->capacity = capacity;
+    }
+
+    self->nodes[self->used].gen = 0;
+    return self->used++;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static void wyt_wheel_free(struct wyt_wheel_impl_t* const self, uint32_t const index)
+{
+    struct wyt_wheel_node_t* const node = &self->nodes[index];
+    node->slot = WYT_WHEEL_NONE;
+
+    // Leaks a single node every 2^32 reuses, which is cheaper than widening every handle.
+    if (node->gen == 0) return;
+
+    node->next = self->free;
+    self->free = index;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static void wyt_wheel_link(struct wyt_wheel_impl_t* const self, uint32_t const index)
+{
+    struct wyt_wheel_node_t* const node = &self->nodes[index];
+    const wyt_utime_t tick = (node->tick < self->current) ? self->current : node->tick;
+
+    // The level is chosen by the most significant group of bits in which the tick differs from the current tick.
+    // This guarantees the node is visited (and cascaded to a lower level) before its tick is reached.
+    const wyt_utime_t diff = tick ^ self->current;
+    uint32_t level = 0;
+    while ((level < WYT_WHEEL_LEVELS) && ((diff >> (WYT_WHEEL_BITS * (level + 1))) != 0)) ++level;
+
+    const uint32_t slot = (level < WYT_WHEEL_LEVELS)
+        ? (level * WYT_WHEEL_SIZE) + (uint32_t)((tick >> (WYT_WHEEL_BITS * level)) & (WYT_WHEEL_SIZE - 1))
+        : WYT_WHEEL_OVERFLOW;
+
+    node->slot = slot;
+    node->prev = WYT_WHEEL_NONE;
+    node->next = self->heads[slot];
+    if (node->next != WYT_WHEEL_NONE) self->nodes[node->next].prev = index;
+    self->heads[slot] = index;
+    self->counts[level] += 1;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static void wyt_wheel_unlink(struct wyt_wheel_impl_t* const self, uint32_t const index)
+{
+    struct wyt_wheel_node_t* const node = &self->nodes[index];
+
+    if (node->prev != WYT_WHEEL_NONE)
+        self->nodes[node->prev].next = node->next;
+    else
+        self->heads[node->slot] = node->next;
+
+    if (node->next != WYT_WHEEL_NONE) self->nodes[node->next].prev = node->prev;
+
+    self->counts[node->slot / WYT_WHEEL_SIZE] -= 1;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static void wyt_wheel_cascade(struct wyt_wheel_impl_t* const self, uint32_t const slot)
+{
+    // The list is detached first, because nodes from the overflow slot may be linked straight back into it.
+    uint32_t index = self->heads[slot];
+    self->heads[slot] = WYT_WHEEL_NONE;
+
+    while (index != WYT_WHEEL_NONE)
+    {
+        const uint32_t next = self->nodes[index].next;
+        self->counts[slot / WYT_WHEEL_SIZE] -= 1;
+        wyt_wheel_link(self, index);
+        index = next;
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static wyt_utime_t wyt_wheel_next(const struct wyt_wheel_impl_t* const self)
+{
+    // Every node in a level is due before any node in a higher level, so the lowest non-empty level decides.
+    for (uint32_t level = 0; level < WYT_WHEEL_LEVELS; ++level)
+    {
+        if (self->counts[level] == 0) continue;
+
+        const uint32_t shift = WYT_WHEEL_BITS * level;
+        const wyt_utime_t base = (self->current >> (shift + WYT_WHEEL_BITS)) << (shift + WYT_WHEEL_BITS);
+
+        for (uint32_t slot = (uint32_t)((self->current >> shift) & (WYT_WHEEL_SIZE - 1)); slot < WYT_WHEEL_SIZE; ++slot)
+        {
+            if (self->heads[(level * WYT_WHEEL_SIZE) + slot] != WYT_WHEEL_NONE) return base | ((wyt_utime_t)slot << shift);
+        }
+    }
+
+    if (self->counts[WYT_WHEEL_LEVELS] != 0)
+    {
+        const uint32_t shift = WYT_WHEEL_BITS * WYT_WHEEL_LEVELS;
+        return ((self->current >> shift) + 1) << shift;
+    }
+
+    return WYT_FOREVER;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static wyt_retval_t WYT_ENTRY wyt_wheel_drive(void* const arg)
+{
+    struct wyt_wheel_impl_t* const self = (struct wyt_wheel_impl_t*)arg;
+
+    for (;;)
+    {
+        wyt_lock_acquire(&self->lock);
+        if (!self->running)
+        {
+            wyt_lock_release(&self->lock);
+            break;
+        }
+
+        // The key is read under the lock, so any timer scheduled after this point bumps the signal and cancels the wait.
+        /// @see atomic_load_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_load
+        const wyt_word_t key = atomic_load_explicit(&self->signal, memory_order_relaxed);
+        const wyt_utime_t tick = wyt_wheel_next(self);
+        self->wake = tick;
+        wyt_lock_release(&self->lock);
+
+        // Ticks too far in the future to be represented in nanoseconds saturate to `WYT_FOREVER`.
+        const wyt_utime_t deadline = (tick > WYT_FOREVER / self->resolution) ? WYT_FOREVER : (tick * self->resolution);
+        (void)wyt_wait(WYT_WORD(&self->signal), key, deadline);
+
+        (void)wyt_wheel_advance((wyt_wheel_t)self, wyt_nanotime());
+    }
+
+    return 0;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static void wyt_ebr_reclaim_chunk(const struct wyt_ebr_chunk_t* const chunk)
+{
+    for (size_t i = 0; i < chunk->count; ++i) chunk->items[i].reclaim(chunk->items[i].ptr);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static wyt_bool_t wyt_ebr_advance(struct wyt_ebr_impl_t* const self)
+{
+    // Pairs with the fence in `wyt_ebr_enter`: either this sees the thread's announcement, or the thread sees the current epoch.
+    /// @see atomic_thread_fence | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_thread_fence
+    atomic_thread_fence(memory_order_seq_cst);
+
+    /// @see atomic_load_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_load
+    const size_t epoch = atomic_load_explicit(&self->epoch, memory_order_relaxed);
+
+    wyt_lock_acquire(&self->lock);
+
+    wyt_bool_t quiescent = true;
+    for (const struct wyt_ebr_record_t* rec = self->records; rec != NULL; rec = rec->next)
+    {
+        const size_t local = atomic_load_explicit(&rec->local, memory_order_relaxed);
+        if (((local & 1u) != 0) && ((local >> 1) != (epoch & (SIZE_MAX >> 1))))
+        {
+            quiescent = false;
+            break;
+        }
+    }
+
+    if (quiescent)
+    {
+        atomic_thread_fence(memory_order_acquire);
+
+        // Fails harmlessly if another thread advanced the epoch first.
+        size_t expected = epoch;
+        /// @see atomic_compare_exchange_strong_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_compare_exchange
+        (void)atomic_compare_exchange_strong_explicit(&self->epoch, &expected, epoch + 1u, memory_order_release, memory_order_relaxed);
+    }
+
+    // Orphaned chunks are reclaimed after the lock is released, since the reclaim functions are arbitrary user code.
+    const size_t current = atomic_load_explicit(&self->epoch, memory_order_acquire);
+    struct wyt_ebr_chunk_t* expired = NULL;
+    for (struct wyt_ebr_chunk_t** link = &self->orphans; *link != NULL; )
+    {
+        struct wyt_ebr_chunk_t* const chunk = *link;
+        if (current - chunk->epoch >= 2u)
+        {
+            *link = chunk->next;
+            chunk->next = expired;
+            expired = chunk;
+        }
+        else
+        {
+            link = &chunk->next;
+        }
+    }
+
+    wyt_lock_release(&self->lock);
+
+    while (expired != NULL)
+    {
+        struct wyt_ebr_chunk_t* const next = expired->next;
+        wyt_ebr_reclaim_chunk(expired);
+        wyt_backend_free(expired);
+        expired = next;
+    }
+
+    return quiescent;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static void wyt_ebr_seal(struct wyt_ebr_record_t* const rec)
+{
+    struct wyt_ebr_chunk_t* const bag = rec->bag;
+    if ((bag == NULL) || (bag->count == 0)) return;
+
+    // Every object in the bag was unlinked before this fence, so no thread can find it after announcing a later epoch.
+    /// @see atomic_thread_fence | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_thread_fence
+    atomic_thread_fence(memory_order_seq_cst);
+
+    /// @see atomic_load_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_load
+    bag->epoch = atomic_load_explicit(&rec->domain->epoch, memory_order_relaxed);
+    bag->next = NULL;
+
+    if (rec->youngest != NULL)
+        rec->youngest->next = bag;
+    else
+        rec->oldest = bag;
+
+    rec->youngest = bag;
+    rec->bag = NULL;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static void wyt_ebr_collect(struct wyt_ebr_record_t* const rec)
+{
+    /// @see atomic_load_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_load
+    const size_t epoch = atomic_load_explicit(&rec->domain->epoch, memory_order_acquire);
+
+    // Chunks are sealed in order, so their epochs never decrease.
+    while ((rec->oldest != NULL) && (epoch - rec->oldest->epoch >= 2u))
+    {
+        struct wyt_ebr_chunk_t* const chunk = rec->oldest;
+        rec->oldest = chunk->next;
+        if (rec->oldest == NULL) rec->youngest = NULL;
+
+        wyt_ebr_reclaim_chunk(chunk);
+        rec->pending -= chunk->count;
+
+        if (rec->spares < WYT_EBR_SPARES)
+        {
+            chunk->next = rec->spare;
+            rec->spare = chunk;
+            rec->spares += 1;
+        }
+        else
+        {
+            wyt_backend_free(chunk);
+        }
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static void wyt_ebr_drain(struct wyt_ebr_record_t* const rec, size_t const goal)
+{
+    wyt_ebr_seal(rec);
+
+    for (unsigned int spins = 0; ; ++spins)
+    {
+        (void)wyt_ebr_advance(rec->domain);
+        wyt_ebr_collect(rec);
+        if (rec->pending <= goal) return;
+
+        // Other threads do not signal when they leave their critical sections, so this backs off from yielding to sleeping.
+        if (spins < 16u) wyt_yield(); else wyt_nanosleep_for(100000);
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static void wyt_fiber_enqueue(struct wyt_fiber_task_t* const task)
+{
+    task->next = NULL;
+    if (wyt_fiber_sched.tail != NULL) wyt_fiber_sched.tail->next = task; else wyt_fiber_sched.head = task;
+    wyt_fiber_sched.tail = task;
+    wyt_fiber_sched.ready += 1;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static void wyt_fiber_main(void* const arg)
+{
+    struct wyt_fiber_task_t* const task = (struct wyt_fiber_task_t*)arg;
+    task->func(task->arg);
+    task->done = true;
+
+    // Returning switches back to the scheduler, which resumed this fiber last.
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static wyt_retval_t WYT_ENTRY wyt_workers_main(void* const arg)
+{
+    struct wyt_workers_impl_t* const self = (struct wyt_workers_impl_t*)arg;
+    wyt_workers_self = self;
+
+    for (;;)
+    {
+        struct wyt_work_t work;
+        (void)wyt_mpmc_pop(self->queue, &work, WYT_FOREVER);
+        if (work.func == NULL) break;
+
+        work.func(work.userdata);
+    }
+
+    return 0;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static void wyt_graph_exec(void* const arg)
+{
+    struct wyt_graph_node_impl_t* node = (struct wyt_graph_node_impl_t*)arg;
+    struct wyt_graph_impl_t* const self = node->graph;
+
+    while (node != NULL)
+    {
+        node->func(node->userdata);
+
+        // One ready successor continues on this thread, the others are handed to the pool.
+        struct wyt_graph_node_impl_t* next = NULL;
+        for (unsigned int i = 0; i < node->successor_count; ++i)
+        {
+            struct wyt_graph_node_impl_t* const succ = &self->nodes[node->successors[i]];
+
+            /// @see atomic_fetch_sub_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_fetch_sub
+            if (atomic_fetch_sub_explicit(&succ->pending, 1u, memory_order_acq_rel) == 1u)
+            {
+                if (next != NULL) wyt_workers_submit(self->workers, wyt_graph_exec, next);
+                next = succ;
+            }
+        }
+
+        if (atomic_fetch_sub_explicit(&self->remaining, 1u, memory_order_acq_rel) == 1u) wyt_wake_all(WYT_WORD(&self->remaining));
+
+        node = next;
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static struct wyt_future_impl_t* wyt_future_alloc(wyt_word_t const refs)
+{
+    wyt_lock_acquire(&wyt_future_lock);
+
+    if (wyt_future_pool == NULL)
+    {
+        struct wyt_future_impl_t* const slab = wyt_backend_alloc(WYT_FUTURE_SLAB * sizeof(struct wyt_future_impl_t));
+        if (slab == NULL)
+        {
+            wyt_lock_release(&wyt_future_lock);
+            return NULL;
+        }
+
+        for (unsigned int i = 0; i < WYT_FUTURE_SLAB; ++i) slab[i].next = (i + 1u < WYT_FUTURE_SLAB) ? &slab[i + 1u] : NULL;
+        wyt_future_pool = slab;
+    }
+
+    struct wyt_future_impl_t* const self = wyt_future_pool;
+    wyt_future_pool = self->next;
+
+    wyt_lock_release(&wyt_future_lock);
+
+    atomic_init(&self->refs, refs);
+    atomic_init(&self->state, WYT_FUTURE_PENDING);
+    atomic_init(&self->dependents, (uintptr_t)0);
+    self->value = NULL;
+    self->next = NULL;
+    self->func = NULL;
+    self->userdata = NULL;
+    self->workers = NULL;
+    self->input = NULL;
+    return self;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static void wyt_future_settle(struct wyt_future_impl_t* const self, void* const value, struct wyt_future_impl_t** const pending)
+{
+    self->value = value;
+
+    // Continuations attached from now on see `WYT_FUTURE_DONE` and dispatch themselves.
+    /// @see atomic_exchange_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_exchange
+    uintptr_t list = atomic_exchange_explicit(&self->dependents, WYT_FUTURE_DONE, memory_order_acq_rel);
+
+    // Waiters may release the last reference as soon as they see `WYT_FUTURE_READY`, so `self` must not be accessed afterwards.
+    // Waking a state that has already been recycled is harmless, since waits may return spuriously.
+    const wyt_word_t prev = atomic_exchange_explicit(&self->state, WYT_FUTURE_READY, memory_order_release);
+    WYT_ASSUME(prev != WYT_FUTURE_READY);
+    if (prev == WYT_FUTURE_SLEEPING) wyt_wake_all(WYT_WORD(&self->state));
+
+    while (list != 0)
+    {
+        struct wyt_future_impl_t* const cont = (struct wyt_future_impl_t*)list;
+        list = (uintptr_t)cont->next;
+
+        cont->input = value;
+        if (cont->workers != NULL)
+        {
+            wyt_workers_submit(cont->workers, wyt_future_continue, cont);
+        }
+        else
+        {
+            cont->next = *pending;
+            *pending = cont;
+        }
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static void wyt_future_run(struct wyt_future_impl_t* pending)
+{
+    while (pending != NULL)
+    {
+        struct wyt_future_impl_t* const self = pending;
+        pending = self->next;
+
+        wyt_future_settle(self, self->func(self->userdata, self->input), &pending);
+
+        // Drops the reference held on behalf of the continuation.
+        wyt_future_release(self);
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static void wyt_future_dispatch(struct wyt_future_impl_t* const self)
+{
+    if (self->workers != NULL) wyt_workers_submit(self->workers, wyt_future_continue, self);
+    else wyt_future_continue(self);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static void wyt_future_continue(void* const arg)
+{
+    struct wyt_future_impl_t* const self = (struct wyt_future_impl_t*)arg;
+
+    self->next = NULL;
+    wyt_future_run(self);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static unsigned char* wyt_pool_object(const struct wyt_pool_impl_t* const self, uint32_t const index)
+{
+    // Later slabs hold most of the objects, so the search starts from the last one.
+    /// @see atomic_load_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_load
+    unsigned int slab = atomic_load_explicit(&self->slab_count, memory_order_acquire);
+    for (;;)
+    {
+        WYT_ASSUME(slab > 0);
+        --slab;
+        const uint32_t start = WYT_POOL_SLAB * ((UINT32_C(1) << slab) - 1u);
+        if (index >= start) return self->slabs[slab] + (size_t)(index - start) * self->stride;
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static uint32_t wyt_pool_index(const struct wyt_pool_impl_t* const self, const void* const ptr)
+{
+    const uintptr_t addr = (uintptr_t)ptr;
+
+    /// @see atomic_load_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_load
+    unsigned int slab = atomic_load_explicit(&self->slab_count, memory_order_acquire);
+    for (;;)
+    {
+        WYT_ASSERT(slab > 0);
+        --slab;
+        const uintptr_t base = (uintptr_t)self->slabs[slab];
+        const uintptr_t bytes = (uintptr_t)(WYT_POOL_SLAB << slab) * self->stride;
+        if ((addr >= base) && (addr - base < bytes))
+        {
+            WYT_ASSUME((addr - base) % self->stride == 0);
+            return WYT_POOL_SLAB * ((UINT32_C(1) << slab) - 1u) + (uint32_t)((addr - base) / self->stride);
+        }
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static void wyt_pool_push(struct wyt_pool_impl_t* const self, uint32_t const first, unsigned char* const last)
+{
+    /// @see atomic_load_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_load
+    uint64_t head = atomic_load_explicit(&self->head, memory_order_relaxed);
+    for (;;)
+    {
+        const uint32_t next = (uint32_t)head;
+        (void)memcpy(last, &next, sizeof(next));
+
+        const uint64_t desired = (uint64_t)first | (((head >> 32) + 1u) << 32);
+        /// @see atomic_compare_exchange_weak_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_compare_exchange
+        if (atomic_compare_exchange_weak_explicit(&self->head, &head, desired, memory_order_release, memory_order_relaxed)) return;
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static void* wyt_pool_pop(struct wyt_pool_impl_t* const self)
+{
+    /// @see atomic_load_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_load
+    uint64_t head = atomic_load_explicit(&self->head, memory_order_acquire);
+    for (;;)
+    {
+        const uint32_t top = (uint32_t)head;
+        if (top == 0) return NULL;
+
+        // The object may be popped and reused concurrently, in which case the tag has changed and the stale link is discarded.
+        // Slabs are never freed while the pool is alive, so reading it is always safe.
+        unsigned char* const object = wyt_pool_object(self, top - 1u);
+        uint32_t next;
+        (void)memcpy(&next, object, sizeof(next));
+
+        const uint64_t desired = (uint64_t)next | (((head >> 32) + 1u) << 32);
+        /// @see atomic_compare_exchange_weak_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_compare_exchange
+        if (atomic_compare_exchange_weak_explicit(&self->head, &head, desired, memory_order_acquire, memory_order_acquire)) return object;
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static wyt_bool_t wyt_pool_grow(struct wyt_pool_impl_t* const self)
+{
+    wyt_lock_acquire(&self->lock);
+
+    // Another thread may have grown the pool while this one waited for the lock.
+    /// @see atomic_load_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_load
+    if ((uint32_t)atomic_load_explicit(&self->head, memory_order_relaxed) != 0)
+    {
+        wyt_lock_release(&self->lock);
+        return true;
+    }
+
+    const unsigned int slab = atomic_load_explicit(&self->slab_count, memory_order_relaxed);
+    const size_t count = (size_t)WYT_POOL_SLAB << slab;
+    const size_t bytes = count * self->stride;
+    if ((slab >= WYT_POOL_SLABS) || (bytes / self->stride != count) || (bytes > SIZE_MAX - self->align))
+    {
+        wyt_lock_release(&self->lock);
+        return false;
+    }
+    void* const block = wyt_backend_alloc(bytes + self->align - 1u);
+    if (block == NULL)
+    {
+        wyt_lock_release(&self->lock);
+        return false;
+    }
+
+    const uintptr_t base = ((uintptr_t)block + (self->align - 1u)) & ~(uintptr_t)(self->align - 1u);
+    self->blocks[slab] = block;
+    self->slabs[slab] = (unsigned char*)base;
+
+    const uint32_t start = WYT_POOL_SLAB * ((UINT32_C(1) << slab) - 1u);
+    for (size_t i = 0; i + 1u < count; ++i)
+    {
+        const uint32_t next = start + (uint32_t)i + 2u;
+        (void)memcpy(self->slabs[slab] + i * self->stride, &next, sizeof(next));
+    }
+
+    /// @see atomic_store_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_store
+    atomic_store_explicit(&self->slab_count, slab + 1u, memory_order_release);
+    wyt_pool_push(self, start + 1u, self->slabs[slab] + (count - 1u) * self->stride);
+
+    wyt_lock_release(&self->lock);
+    return true;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static void wyt_pool_flush(struct wyt_pool_impl_t* const self, struct wyt_pool_cache_t* const cache, unsigned int const count)
+{
+    // The links are rewritten from pointers to indices, each link being read before it is overwritten.
+    unsigned char* object = (unsigned char*)cache->head;
+    const uint32_t first = wyt_pool_index(self, object) + 1u;
+
+    for (unsigned int i = 1; i < count; ++i)
+    {
+        void* next;
+        (void)memcpy(&next, object, sizeof(next));
+        const uint32_t index = wyt_pool_index(self, next) + 1u;
+        (void)memcpy(object, &index, sizeof(index));
+        object = (unsigned char*)next;
+    }
+
+    (void)memcpy(&cache->head, object, sizeof(void*));
+    cache->count -= count;
+    wyt_pool_push(self, first, object);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static void wyt_pool_tally(struct wyt_pool_impl_t* const self, struct wyt_pool_cache_t* const cache)
+{
+    /// @see atomic_fetch_add_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_fetch_add
+    (void)atomic_fetch_add_explicit(&self->allocs, cache->allocs, memory_order_relaxed);
+    (void)atomic_fetch_add_explicit(&self->cache_hits, cache->hits, memory_order_relaxed);
+    cache->allocs = 0;
+    cache->hits = 0;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static struct wyt_pool_cache_t* wyt_pool_cache(struct wyt_pool_impl_t* const self)
+{
+    if (self->slot >= WYT_POOL_CACHES) return NULL;
+
+    struct wyt_pool_cache_t* const cache = &wyt_pool_caches[self->slot];
+    if (cache->id == self->id) return cache;
+
+    wyt_lock_acquire(&wyt_pool_lock);
+    if (wyt_pool_key == NULL) wyt_pool_key = wyt_tls_create(wyt_pool_exit);
+    const wyt_tls_t key = wyt_pool_key;
+    wyt_lock_release(&wyt_pool_lock);
+
+    // Without a destructor, objects cached by the thread would stay out of use once it exits.
+    if (key == NULL) return NULL;
+    if ((wyt_tls_get(key) != (void*)wyt_pool_caches) && !wyt_tls_set(key, (void*)wyt_pool_caches)) return NULL;
+
+    // The slot belonged to a destroyed pool, whose objects no longer exist.
+    cache->id = self->id;
+    cache->head = NULL;
+    cache->count = 0;
+    cache->allocs = 0;
+    cache->hits = 0;
+    return cache;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static void wyt_pool_exit(void* const value)
+{
+    // Fibers may be destroyed by a thread other than the one whose caches they registered, which must not touch them.
+    struct wyt_pool_cache_t* const caches = (struct wyt_pool_cache_t*)value;
+    if (caches != wyt_pool_caches) return;
+
+    // Holding the lock keeps the pools from being destroyed while their objects are returned.
+    wyt_lock_acquire(&wyt_pool_lock);
+    for (unsigned int slot = 0; slot < WYT_POOL_CACHES; ++slot)
+    {
+        struct wyt_pool_cache_t* const cache = &caches[slot];
+        struct wyt_pool_impl_t* const pool = wyt_pool_live[slot];
+        if ((pool != NULL) && (cache->id == pool->id))
+        {
+            if (cache->count > 0) wyt_pool_flush(pool, cache, cache->count);
+            wyt_pool_tally(pool, cache);
+        }
+
+        // Later destructors that use a pool register the caches again.
+        cache->id = 0;
+    }
+    wyt_lock_release(&wyt_pool_lock);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static void wyt_chan_changed(struct wyt_chan_impl_t* const self)
+{
+    // The preceding Event Count notification already issued the fence that pairs with the one in `wyt_select`.
+    /// @see atomic_load_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_load
+    if (atomic_load_explicit(&self->selectors, memory_order_relaxed) != 0) wyt_evcount_notify((wyt_evcount_t)&wyt_select_evcount);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static wyt_chan_result_t wyt_select_try(const wyt_select_case_t* const cases, size_t const count, size_t const start, size_t* const index)
+{
+    for (size_t n = 0; n < count; ++n)
+    {
+        const size_t i = (start + n < count) ? (start + n) : (start + n - count);
+        const wyt_select_case_t* const item = &cases[i];
+
+        const wyt_chan_result_t res = item->send ? wyt_chan_try_send(item->chan, item->message) : wyt_chan_try_recv(item->chan, item->message);
+        if (res != wyt_chan_timeout)
+        {
+            *index = i;
+            return res;
+        }
+    }
+    return wyt_chan_timeout;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static wyt_retval_t WYT_ENTRY wyt_pooled_main(void* const ptr)
+{
+    struct wyt_pooled_t* const self = (struct wyt_pooled_t*)ptr;
+
+    for (;;)
+    {
+        // Set while the task runs, so that `wyt_pooled_exit` can finish it if the thread exits early.
+        struct wyt_task_t* const task = self->task;
+        wyt_pooled_self = self;
+        task->retval = task->func(task->arg);
+        wyt_pooled_self = NULL;
+
+        wyt_lock_acquire(&wyt_pooled_lock);
+        wyt_pooled_finish(task);
+
+        self->task = NULL;
+        self->signal = 0;
+        wyt_bool_t parked = (wyt_pooled_parked < WYT_POOLED_MAX);
+        if (parked)
+        {
+            self->next = wyt_pooled_idle;
+            wyt_pooled_idle = self;
+            ++wyt_pooled_parked;
+        }
+
+        const wyt_utime_t deadline = wyt_nanotime() + WYT_POOLED_IDLE;
+        while (parked && (self->signal == 0))
+        {
+            wyt_lock_release(&wyt_pooled_lock);
+            const wyt_bool_t woken = wyt_wait(&self->signal, 0, deadline);
+            wyt_lock_acquire(&wyt_pooled_lock);
+
+            if (!woken && (self->signal == 0))
+            {
+                // Timed out without being claimed, so the thread leaves the pool.
+                struct wyt_pooled_t** link = &wyt_pooled_idle;
+                while (*link != self) link = &(*link)->next;
+                *link = self->next;
+                --wyt_pooled_parked;
+                parked = false;
+            }
+        }
+        wyt_lock_release(&wyt_pooled_lock);
+
+        if (!parked) break;
+    }
+
+    wyt_backend_free(self);
+    return (wyt_retval_t)0;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static void wyt_pooled_finish(struct wyt_task_t* const task)
+{
+    task->state |= WYT_POOLED_DONE;
+
+    if ((task->state & WYT_POOLED_DETACHED) != 0) wyt_backend_free(task);
+    else if ((task->state & WYT_POOLED_JOINING) != 0) wyt_wake_all(&task->state);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_pooled_exit(wyt_retval_t const retval)
+{
+    struct wyt_pooled_t* const self = wyt_pooled_self;
+    if (self == NULL) return;
+    wyt_pooled_self = NULL;
+
+    self->task->retval = retval;
+
+    wyt_lock_acquire(&wyt_pooled_lock);
+    wyt_pooled_finish(self->task);
+    wyt_lock_release(&wyt_pooled_lock);
+
+    // The thread is not parked while it runs a task, so nothing else refers to it.
+    wyt_backend_free(self);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_bool_t wyt_pooled_join(wyt_thread_t const thread, wyt_utime_t const deadline, wyt_retval_t* const retval)
+{
+    struct wyt_task_t* const task = (struct wyt_task_t*)((uintptr_t)thread & ~(uintptr_t)1u);
+
+    wyt_lock_acquire(&wyt_pooled_lock);
+    while ((task->state & WYT_POOLED_DONE) == 0)
+    {
+        if ((deadline != WYT_FOREVER) && (wyt_nanotime() >= deadline))
+        {
+            wyt_lock_release(&wyt_pooled_lock);
+            return false;
+        }
+
+        task->state |= WYT_POOLED_JOINING;
+        const wyt_word_t state = task->state;
+
+        wyt_lock_release(&wyt_pooled_lock);
+        (void)wyt_wait(&task->state, state, deadline);
+        wyt_lock_acquire(&wyt_pooled_lock);
+    }
+    wyt_lock_release(&wyt_pooled_lock);
+
+    if (retval != NULL) *retval = task->retval;
+    wyt_backend_free(task);
+    return true;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_pooled_detach(wyt_thread_t const thread)
+{
+    struct wyt_task_t* const task = (struct wyt_task_t*)((uintptr_t)thread & ~(uintptr_t)1u);
+
+    wyt_lock_acquire(&wyt_pooled_lock);
+    const wyt_bool_t done = (task->state & WYT_POOLED_DONE) != 0;
+    task->state |= WYT_POOLED_DETACHED;
+    wyt_lock_release(&wyt_pooled_lock);
+
+    if (done) wyt_backend_free(task);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static struct wyt_arena_chunk_t* wyt_arena_map(size_t const size)
+{
+    unsigned char* const base = wyt_backend_map(size);
+    if (base == NULL) return NULL;
+
+    struct wyt_arena_chunk_t* const chunk = (struct wyt_arena_chunk_t*)base;
+    chunk->next = NULL;
+    chunk->end = base + size;
+    return chunk;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static void* wyt_arena_grow(struct wyt_arena_impl_t* const self, size_t const size, size_t const align)
+{
+    const size_t header = sizeof(struct wyt_arena_chunk_t);
+    if (size > SIZE_MAX - header - align - self->page) return NULL;
+    const size_t needed = header + (align - 1) + size;
+
+    struct wyt_arena_chunk_t* chunk = self->current->next;
+    if (needed > self->chunk_size)
+    {
+        // Oversized allocations get a chunk of their own, which is kept for reuse like any other.
+        chunk = wyt_arena_map(((needed + self->page - 1) / self->page) * self->page);
+        if (chunk == NULL) return NULL;
+        chunk->next = self->current->next;
+        self->current->next = chunk;
+    }
+    else if (chunk == NULL)
+    {
+        chunk = wyt_arena_map(self->chunk_size);
+        if (chunk == NULL) return NULL;
+        self->current->next = chunk;
+    }
+
+    const uintptr_t start = (uintptr_t)(chunk + 1);
+    const uintptr_t aligned = (start + (align - 1)) & ~(uintptr_t)(align - 1);
+
+    self->current = chunk;
+    self->position = (unsigned char*)aligned + size;
+    self->limit = chunk->end;
+    return (void*)aligned;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static void wyt_shring_notify(_Atomic(wyt_word_t)* const state, void* const event)
+{
+    // Pairs with the fetch-or in `wyt_shring_wait`: either the waiter sees the new position, or the notifier sees the waiter's flag.
+    /// @see atomic_thread_fence | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_thread_fence
+    atomic_thread_fence(memory_order_seq_cst);
+
+    /// @see atomic_load_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_load
+    if ((atomic_load_explicit(state, memory_order_relaxed) & 1u) == 0) return;
+
+    // Only one side notifies each word, so the flag cannot be cleared concurrently.
+    // Adding 1 clears the waiter flag and advances the epoch, invalidating all outstanding keys.
+    /// @see atomic_fetch_add_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_fetch_add
+    (void)atomic_fetch_add_explicit(state, 1u, memory_order_release);
+    wyt_backend_shring_wake(event, (const void*)state);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static size_t wyt_shring_available(const struct wyt_shring_impl_t* const self, wyt_bool_t const writer)
+{
+    /// @see atomic_load_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_load
+    const unsigned long long head = atomic_load_explicit(&self->header->head, memory_order_acquire);
+    const unsigned long long tail = atomic_load_explicit(&self->header->tail, memory_order_acquire);
+    const size_t used = (size_t)(tail - head);
+
+    return writer ? (self->mask + 1u) - used : used;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static wyt_bool_t wyt_shring_wait(const struct wyt_shring_impl_t* const self, wyt_bool_t const writer, size_t const bytes, wyt_utime_t const deadline)
+{
+    WYT_ASSUME((bytes > 0) && (bytes <= self->mask + 1u));
+    _Atomic(wyt_word_t)* const state = writer ? &self->header->writable : &self->header->readable;
+    void* const event = writer ? self->writable : self->readable;
+
+    for (;;)
+    {
+        if (wyt_shring_available(self, writer) >= bytes) return true;
+
+        // Sequentially-consistent, so that the re-check below cannot be reordered before this.
+        /// @see atomic_fetch_or_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_fetch_or
+        const wyt_word_t key = atomic_fetch_or_explicit(state, 1u, memory_order_seq_cst) | 1u;
+
+        if (wyt_shring_available(self, writer) >= bytes) return true;
+
+        if (!wyt_backend_shring_wait(event, (const void*)state, key, deadline))
+            return wyt_shring_available(self, writer) >= bytes;
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern unsigned int wyt_densify(const unsigned long long* const keys, unsigned int* const indices, unsigned int const count)
+{
+    unsigned int distinct = 0;
+    for (unsigned int i = 0; i < count; ++i)
+    {
+        unsigned int j = 0;
+        while ((j < i) && (keys[j] != keys[i])) ++j;
+
+        indices[i] = (j < i) ? indices[j] : distinct++;
+    }
+    return distinct;
+}
+
+// ================================================================================================================================
+//  Public Definitions
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_precise_sleep_until(wyt_utime_t const timepoint)
+{
+    const wyt_utime_t margin = wyt_margin;
+    const wyt_utime_t now = wyt_nanotime();
+    if (now >= timepoint) return;
+
+    if (timepoint - now > margin)
+    {
+        const wyt_utime_t target = timepoint - margin;
+        wyt_nanosleep_until(target);
+        const wyt_utime_t overshoot = wyt_nanotime() - target;
+
+        // Grows quickly when a sleep overshoots, but only shrinks slowly, so that one lucky wake-up does not make the next sleep late.
+        wyt_utime_t next = margin - (margin / 16);
+        const wyt_utime_t padded = overshoot + (overshoot / 4);
+        if (padded > next) next = padded;
+        if (next < WYT_MARGIN_MIN) next = WYT_MARGIN_MIN;
+        if (next > WYT_MARGIN_MAX) next = WYT_MARGIN_MAX;
+        wyt_margin = next;
+    }
+
+    while (wyt_nanotime() < timepoint) WYT_PAUSE();
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_barrier_t wyt_barrier_create(unsigned int const count, wyt_barrier_callback_t const callback, void* const userdata)
+{
+    if ((count == 0) || (count > WYT_BARRIER_MASK)) return NULL;
+    struct wyt_barrier_impl_t* const self = wyt_backend_alloc(sizeof(struct wyt_barrier_impl_t));
+    if (self == NULL) return NULL;
+
+    atomic_init(&self->state, 0);
+    self->count = count;
+    self->callback = callback;
+    self->userdata = userdata;
+
+    return (wyt_barrier_t)self;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_barrier_destroy(wyt_barrier_t const barrier)
+{
+    WYT_ASSUME(barrier != NULL);
+    wyt_backend_free(barrier);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_bool_t wyt_barrier_arrive_and_wait(wyt_barrier_t const barrier)
+{
+    WYT_ASSUME(barrier != NULL);
+    struct wyt_barrier_impl_t* const self = (struct wyt_barrier_impl_t*)barrier;
+
+    /// @see atomic_fetch_add_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_fetch_add
+    const wyt_word_t prev = atomic_fetch_add_explicit(&self->state, 1, memory_order_acq_rel);
+    const wyt_word_t phase = prev & ~WYT_BARRIER_MASK;
+
+    if ((prev & WYT_BARRIER_MASK) + 1 == self->count)
+    {
+        if (self->callback != NULL) self->callback(self->userdata);
+
+        // Resets the arrival count and advances the phase (wrapping is harmless) in a single store.
+        /// @see atomic_store_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_store
+        atomic_store_explicit(&self->state, phase + (WYT_BARRIER_MASK + 1u), memory_order_release);
+        wyt_wake_all(WYT_WORD(&self->state));
+        return true;
+    }
+
+    wyt_word_t state = prev + 1;
+    do {
+        (void)wyt_wait(WYT_WORD(&self->state), state, WYT_FOREVER);
+
+        /// @see atomic_load_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_load
+        state = atomic_load_explicit(&self->state, memory_order_acquire);
+    } while ((state & ~WYT_BARRIER_MASK) == phase);
+
+    return false;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_latch_t wyt_latch_create(unsigned int const count)
+{
+    struct wyt_latch_impl_t* const self = wyt_backend_alloc(sizeof(struct wyt_latch_impl_t));
+    if (self == NULL) return NULL;
+
+    atomic_init(&self->count, count);
+
+    return (wyt_latch_t)self;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_latch_destroy(wyt_latch_t const latch)
+{
+    WYT_ASSUME(latch != NULL);
+    wyt_backend_free(latch);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_latch_count_down(wyt_latch_t const latch, unsigned int const count)
+{
+    WYT_ASSUME(latch != NULL);
+    struct wyt_latch_impl_t* const self = (struct wyt_latch_impl_t*)latch;
+
+    /// @see atomic_fetch_sub_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_fetch_sub
+    const wyt_word_t prev = atomic_fetch_sub_explicit(&self->count, count, memory_order_release);
+    WYT_ASSUME(prev >= count);
+
+    if ((prev == count) && (count != 0)) wyt_wake_all(WYT_WORD(&self->count));
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_bool_t wyt_latch_wait(wyt_latch_t const latch, wyt_utime_t const deadline)
+{
+    WYT_ASSUME(latch != NULL);
+    struct wyt_latch_impl_t* const self = (struct wyt_latch_impl_t*)latch;
+
+    for (;;)
+    {
+        /// @see atomic_load_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_load
+        const wyt_word_t count = atomic_load_explicit(&self->count, memory_order_acquire);
+        if (count == 0) return true;
+
+        if (!wyt_wait(WYT_WORD(&self->count), count, deadline))
+            return atomic_load_explicit(&self->count, memory_order_acquire) == 0;
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_evcount_t wyt_evcount_create(void)
+{
+    struct wyt_evcount_impl_t* const self = wyt_backend_alloc(sizeof(struct wyt_evcount_impl_t));
+    if (self == NULL) return NULL;
+
+    atomic_init(&self->state, 0);
+
+    return (wyt_evcount_t)self;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_evcount_destroy(wyt_evcount_t const evcount)
+{
+    WYT_ASSUME(evcount != NULL);
+    wyt_backend_free(evcount);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_word_t wyt_evcount_prepare(wyt_evcount_t const evcount)
+{
+    WYT_ASSUME(evcount != NULL);
+    struct wyt_evcount_impl_t* const self = (struct wyt_evcount_impl_t*)evcount;
+
+    // Sequentially-consistent, so that the waiter's subsequent re-check of its condition cannot be reordered before this.
+    /// @see atomic_fetch_or_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_fetch_or
+    return atomic_fetch_or_explicit(&self->state, 1u, memory_order_seq_cst) | 1u;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_bool_t wyt_evcount_wait(wyt_evcount_t const evcount, wyt_word_t const key, wyt_utime_t const deadline)
+{
+    WYT_ASSUME(evcount != NULL);
+    struct wyt_evcount_impl_t* const self = (struct wyt_evcount_impl_t*)evcount;
+
+    for (;;)
+    {
+        /// @see atomic_load_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_load
+        if (atomic_load_explicit(&self->state, memory_order_acquire) != key) return true;
+
+        if (!wyt_wait(WYT_WORD(&self->state), key, deadline))
+            return atomic_load_explicit(&self->state, memory_order_acquire) != key;
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_evcount_notify(wyt_evcount_t const evcount)
+{
+    WYT_ASSUME(evcount != NULL);
+    struct wyt_evcount_impl_t* const self = (struct wyt_evcount_impl_t*)evcount;
+
+    // Pairs with `wyt_evcount_prepare`: either the waiter sees the notifier's data, or the notifier sees the waiter's flag.
+    /// @see atomic_thread_fence | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_thread_fence
+    atomic_thread_fence(memory_order_seq_cst);
+
+    /// @see atomic_load_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_load
+    wyt_word_t state = atomic_load_explicit(&self->state, memory_order_relaxed);
+    while ((state & 1u) != 0)
+    {
+        // Adding 1 clears the waiter flag and advances the epoch, invalidating all outstanding keys.
+        /// @see atomic_compare_exchange_weak_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_compare_exchange
+        if (atomic_compare_exchange_weak_explicit(&self->state, &state, state + 1u, memory_order_release, memory_order_relaxed))
+        {
+            wyt_wake_all(WYT_WORD(&self->state));
+            return;
+        }
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_wheel_t wyt_wheel_create(wyt_utime_t const resolution)
+{
+    if (resolution == 0) return NULL;
+    struct wyt_wheel_impl_t* const self = wyt_backend_alloc(sizeof(struct wyt_wheel_impl_t));
+    if (self == NULL) return NULL;
+
+    atomic_init(&self->lock, 0);
+    atomic_init(&self->signal, 0);
+
+    self->resolution = resolution;
+    self->current = wyt_nanotime() / resolution;
+    self->wake = WYT_FOREVER;
+
+    self->nodes = NULL;
+    self->capacity = 0;
+    self->used = 0;
+    self->free = WYT_WHEEL_NONE;
+    self->fired = WYT_WHEEL_NONE;
+
+    for (uint32_t i = 0; i <= WYT_WHEEL_LEVELS; ++i) self->counts[i] = 0;
+    for (uint32_t i = 0; i <= WYT_WHEEL_OVERFLOW; ++i) self->heads[i] = WYT_WHEEL_NONE;
+
+    self->driver = NULL;
+    self->running = false;
+
+    return (wyt_wheel_t)self;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_wheel_destroy(wyt_wheel_t const wheel)
+{
+    WYT_ASSUME(wheel != NULL);
+    struct wyt_wheel_impl_t* const self = (struct wyt_wheel_impl_t*)wheel;
+    WYT_ASSUME(!self->running);
+    wyt_backend_free(self->nodes);
+    wyt_backend_free(self);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_timer_t wyt_wheel_schedule(wyt_wheel_t const wheel, wyt_utime_t const deadline, wyt_timer_callback_t const callback, void* const userdata)
+{
+    WYT_ASSUME(wheel != NULL);
+    WYT_ASSUME(callback != NULL);
+    struct wyt_wheel_impl_t* const self = (struct wyt_wheel_impl_t*)wheel;
+
+    wyt_lock_acquire(&self->lock);
+
+    const uint32_t index = wyt_wheel_alloc(self);
+    if (index == WYT_WHEEL_NONE)
+    {
+        wyt_lock_release(&self->lock);
+        return 0;
+    }
+
+    struct wyt_wheel_node_t* const node = &self->nodes[index];
+    // Rounds up, so that timers never fire early.
+    node->tick = (deadline / self->resolution) + ((deadline % self->resolution) != 0);
+    node->callback = callback;
+    node->userdata = userdata;
+    wyt_wheel_link(self, index);
+
+    const wyt_timer_t timer = ((wyt_timer_t)node->gen << 32) | (wyt_timer_t)(index + 1u);
+
+    // Only wakes up the driver if it would otherwise sleep past the new timer.
+    const wyt_bool_t wake = self->running && (node->tick < self->wake);
+    if (wake)
+    {
+        self->wake = node->tick;
+        /// @see atomic_fetch_add_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_fetch_add
+        (void)atomic_fetch_add_explicit(&self->signal, 1, memory_order_relaxed);
+    }
+
+    wyt_lock_release(&self->lock);
+
+    if (wake) wyt_wake_one(WYT_WORD(&self->signal));
+    return timer;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_bool_t wyt_wheel_cancel(wyt_wheel_t const wheel, wyt_timer_t const timer)
+{
+    WYT_ASSUME(wheel != NULL);
+    struct wyt_wheel_impl_t* const self = (struct wyt_wheel_impl_t*)wheel;
+
+    const uint32_t index = (uint32_t)(timer & 0xFFFFFFFFu) - 1u;
+    const uint32_t gen = (uint32_t)(timer >> 32);
+
+    wyt_lock_acquire(&self->lock);
+
+    const wyt_bool_t pending = (index < self->used)
+        && (self->nodes[index].gen == gen)
+        && (self->nodes[index].slot <= WYT_WHEEL_OVERFLOW);
+
+    if (pending)
+    {
+        struct wyt_wheel_node_t* const node = &self->nodes[index];
+        wyt_wheel_unlink(self, index);
+
+        node->gen += 1;
+        wyt_wheel_free(self, index);
+    }
+
+    wyt_lock_release(&self->lock);
+    return pending;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern size_t wyt_wheel_advance(wyt_wheel_t const wheel, wyt_utime_t const now)
+{
+    WYT_ASSUME(wheel != NULL);
+    struct wyt_wheel_impl_t* const self = (struct wyt_wheel_impl_t*)wheel;
+
+    const wyt_utime_t target = now / self->resolution;
+
+    wyt_lock_acquire(&self->lock);
+
+    while (self->current <= target)
+    {
+        const wyt_utime_t tick = self->current;
+
+        // Cascades the slots whose spans begin at this tick, from the highest level down.
+        if ((tick & ((1uLL << (WYT_WHEEL_BITS * WYT_WHEEL_LEVELS)) - 1u)) == 0) wyt_wheel_cascade(self, WYT_WHEEL_OVERFLOW);
+        for (uint32_t level = WYT_WHEEL_LEVELS - 1u; level > 0; --level)
+        {
+            const uint32_t shift = WYT_WHEEL_BITS * level;
+            if ((tick & ((1uLL << shift) - 1u)) != 0) continue;
+
+            wyt_wheel_cascade(self, (level * WYT_WHEEL_SIZE) + (uint32_t)((tick >> shift) & (WYT_WHEEL_SIZE - 1)));
+        }
+
+        // Moves every node of the current slot onto the fired list, making their handles stale.
+        const uint32_t slot = (uint32_t)(tick & (WYT_WHEEL_SIZE - 1));
+        uint32_t index = self->heads[slot];
+        self->heads[slot] = WYT_WHEEL_NONE;
+        while (index != WYT_WHEEL_NONE)
+        {
+            struct wyt_wheel_node_t* const node = &self->nodes[index];
+            const uint32_t next = node->next;
+
+            self->counts[0] -= 1;
+            node->slot = WYT_WHEEL_FIRING;
+            node->gen += 1;
+            node->next = self->fired;
+            self->fired = index;
+
+            index = next;
+        }
+
+        // Skips over ticks that cannot have any work, ie: up to the next span boundary of the lowest non-empty level.
+        uint32_t empty = 0;
+        while ((empty < WYT_WHEEL_LEVELS) && (self->counts[empty] == 0)) ++empty;
+
+        const uint32_t shift = WYT_WHEEL_BITS * empty;
+        const wyt_utime_t next = ((tick >> shift) + 1u) << shift;
+        self->current = (next > target) ? (target + 1u) : next;
+    }
+
+    size_t count = 0;
+    while (self->fired != WYT_WHEEL_NONE)
+    {
+        // Callbacks are copied out in batches, since the node pool may be reallocated by callbacks scheduling new timers.
+        struct { wyt_timer_callback_t callback; void* userdata; } batch[WYT_WHEEL_BATCH];
+        uint32_t len = 0;
+
+        while ((len < WYT_WHEEL_BATCH) && (self->fired != WYT_WHEEL_NONE))
+        {
+            const uint32_t index = self->fired;
+            struct wyt_wheel_node_t* const node = &self->nodes[index];
+
+            batch[len].callback = node->callback;
+            batch[len].userdata = node->userdata;
+            ++len;
+
+            self->fired = node->next;
+            wyt_wheel_free(self, index);
+        }
+
+        wyt_lock_release(&self->lock);
+        for (uint32_t i = 0; i < len; ++i) batch[i].callback(batch[i].userdata);
+        count += len;
+        wyt_lock_acquire(&self->lock);
+    }
+
+    wyt_lock_release(&self->lock);
+    return count;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_bool_t wyt_wheel_start(wyt_wheel_t const wheel)
+{
+    WYT_ASSUME(wheel != NULL);
+    struct wyt_wheel_impl_t* const self = (struct wyt_wheel_impl_t*)wheel;
+
+    wyt_lock_acquire(&self->lock);
+    const wyt_bool_t running = self->running;
+    self->running = true;
+    self->wake = WYT_FOREVER;
+    wyt_lock_release(&self->lock);
+
+    if (running) return false;
+
+    const wyt_thread_t driver = wyt_spawn(wyt_wheel_drive, self);
+
+    wyt_lock_acquire(&self->lock);
+    self->driver = driver;
+    self->running = (driver != NULL);
+    wyt_lock_release(&self->lock);
+
+    return driver != NULL;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_wheel_stop(wyt_wheel_t const wheel)
+{
+    WYT_ASSUME(wheel != NULL);
+    struct wyt_wheel_impl_t* const self = (struct wyt_wheel_impl_t*)wheel;
+
+    wyt_lock_acquire(&self->lock);
+    const wyt_thread_t driver = self->driver;
+    self->running = false;
+    self->driver = NULL;
+    /// @see atomic_fetch_add_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_fetch_add
+    (void)atomic_fetch_add_explicit(&self->signal, 1, memory_order_relaxed);
+    wyt_lock_release(&self->lock);
+
+    if (driver == NULL) return;
+
+    wyt_wake_one(WYT_WORD(&self->signal));
+    (void)wyt_join(driver);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_spsc_t wyt_spsc_create(size_t const capacity, size_t const size)
+{
+    if ((capacity == 0) || (size == 0) || (capacity > (SIZE_MAX / 2u) + 1u)) return NULL;
+
+    size_t slots = 1;
+    while (slots < capacity) slots *= 2u;
+    if (slots > SIZE_MAX / size) return NULL;
+    struct wyt_spsc_impl_t* const self = wyt_backend_alloc(sizeof(struct wyt_spsc_impl_t));
+    if (self == NULL) return NULL;
+
+    self->buffer = wyt_backend_alloc(slots * size);
+    if (self->buffer == NULL)
+    {
+        wyt_backend_free(self);
+        return NULL;
+    }
+
+    self->mask = slots - 1u;
+    self->size = size;
+
+    atomic_init(&self->tail, 0);
+    self->head_cache = 0;
+
+    atomic_init(&self->head, 0);
+    self->tail_cache = 0;
+
+    atomic_init(&self->readable.state, 0);
+    atomic_init(&self->writable.state, 0);
+
+    return (wyt_spsc_t)self;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_spsc_destroy(wyt_spsc_t const spsc)
+{
+    WYT_ASSUME(spsc != NULL);
+    struct wyt_spsc_impl_t* const self = (struct wyt_spsc_impl_t*)spsc;
+    wyt_backend_free(self->buffer);
+    wyt_backend_free(self);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern size_t wyt_spsc_push(wyt_spsc_t const spsc, const void* const elements, size_t const count)
+{
+    WYT_ASSUME(spsc != NULL);
+    WYT_ASSUME((elements != NULL) || (count == 0));
+    struct wyt_spsc_impl_t* const self = (struct wyt_spsc_impl_t*)spsc;
+
+    /// @see atomic_load_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_load
+    const size_t tail = atomic_load_explicit(&self->tail, memory_order_relaxed);
+
+    // Only touches the consumer's cache line when the cached index does not leave enough room.
+    size_t room = (self->mask + 1u) - (tail - self->head_cache);
+    if (room < count)
+    {
+        self->head_cache = atomic_load_explicit(&self->head, memory_order_acquire);
+        room = (self->mask + 1u) - (tail - self->head_cache);
+    }
+
+    const size_t len = (count < room) ? count : room;
+    if (len == 0) return 0;
+
+    const size_t index = tail & self->mask;
+    const size_t first = ((self->mask + 1u) - index < len) ? ((self->mask + 1u) - index) : len;
+
+    /// @see memcpy | <string.h> [libc] (C89) | https://en.cppreference.com/w/c/string/byte/memcpy
+    memcpy(self->buffer + (index * self->size), elements, first * self->size);
+    memcpy(self->buffer, (const unsigned char*)elements + (first * self->size), (len - first) * self->size);
+
+    /// @see atomic_store_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_store
+    atomic_store_explicit(&self->tail, tail + len, memory_order_release);
+    wyt_evcount_notify((wyt_evcount_t)&self->readable);
+
+    return len;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern size_t wyt_spsc_pop(wyt_spsc_t const spsc, void* const elements, size_t const count)
+{
+    WYT_ASSUME(spsc != NULL);
+    WYT_ASSUME((elements != NULL) || (count == 0));
+    struct wyt_spsc_impl_t* const self = (struct wyt_spsc_impl_t*)spsc;
+
+    /// @see atomic_load_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_load
+    const size_t head = atomic_load_explicit(&self->head, memory_order_relaxed);
+
+    // Only touches the producer's cache line when the cached index does not provide enough elements.
+    size_t avail = self->tail_cache - head;
+    if (avail < count)
+    {
+        self->tail_cache = atomic_load_explicit(&self->tail, memory_order_acquire);
+        avail = self->tail_cache - head;
+    }
+
+    const size_t len = (count < avail) ? count : avail;
+    if (len == 0) return 0;
+
+    const size_t index = head & self->mask;
+    const size_t first = ((self->mask + 1u) - index < len) ? ((self->mask + 1u) - index) : len;
+
+    /// @see memcpy | <string.h> [libc] (C89) | https://en.cppreference.com/w/c/string/byte/memcpy
+    memcpy(elements, self->buffer + (index * self->size), first * self->size);
+    memcpy((unsigned char*)elements + (first * self->size), self->buffer, (len - first) * self->size);
+
+    /// @see atomic_store_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_store
+    atomic_store_explicit(&self->head, head + len, memory_order_release);
+    wyt_evcount_notify((wyt_evcount_t)&self->writable);
+
+    return len;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_bool_t wyt_spsc_wait_push(wyt_spsc_t const spsc, wyt_utime_t const deadline)
+{
+    WYT_ASSUME(spsc != NULL);
+    struct wyt_spsc_impl_t* const self = (struct wyt_spsc_impl_t*)spsc;
+
+    /// @see atomic_load_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_load
+    const size_t tail = atomic_load_explicit(&self->tail, memory_order_relaxed);
+
+    for (;;)
+    {
+        if (tail - self->head_cache <= self->mask) return true;
+
+        const wyt_word_t key = wyt_evcount_prepare((wyt_evcount_t)&self->writable);
+
+        self->head_cache = atomic_load_explicit(&self->head, memory_order_acquire);
+        if (tail - self->head_cache <= self->mask) return true;
+
+        if (!wyt_evcount_wait((wyt_evcount_t)&self->writable, key, deadline))
+        {
+            self->head_cache = atomic_load_explicit(&self->head, memory_order_acquire);
+            return tail - self->head_cache <= self->mask;
+        }
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_bool_t wyt_spsc_wait_pop(wyt_spsc_t const spsc, wyt_utime_t const deadline)
+{
+    WYT_ASSUME(spsc != NULL);
+    struct wyt_spsc_impl_t* const self = (struct wyt_spsc_impl_t*)spsc;
+
+    /// @see atomic_load_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_load
+    const size_t head = atomic_load_explicit(&self->head, memory_order_relaxed);
+
+    for (;;)
+    {
+        if (self->tail_cache != head) return true;
+
+        const wyt_word_t key = wyt_evcount_prepare((wyt_evcount_t)&self->readable);
+
+        self->tail_cache = atomic_load_explicit(&self->tail, memory_order_acquire);
+        if (self->tail_cache != head) return true;
+
+        if (!wyt_evcount_wait((wyt_evcount_t)&self->readable, key, deadline))
+        {
+            self->tail_cache = atomic_load_explicit(&self->tail, memory_order_acquire);
+            return self->tail_cache != head;
+        }
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_mpmc_t wyt_mpmc_create(size_t const capacity, size_t const size)
+{
+    if ((capacity == 0) || (size == 0) || (capacity > (SIZE_MAX / 2u) + 1u)) return NULL;
+
+    size_t slots = 2;
+    while (slots < capacity) slots *= 2u;
+
+    // Cells are padded so that each sequence number is suitably aligned.
+    const size_t align = sizeof(_Atomic(size_t));
+    if (size > SIZE_MAX - (2u * align)) return NULL;
+    const size_t stride = ((align + size + align - 1u) / align) * align;
+    if (slots > SIZE_MAX / stride) return NULL;
+    struct wyt_mpmc_impl_t* const self = wyt_backend_alloc(sizeof(struct wyt_mpmc_impl_t));
+    if (self == NULL) return NULL;
+
+    self->cells = wyt_backend_alloc(slots * stride);
+    if (self->cells == NULL)
+    {
+        wyt_backend_free(self);
+        return NULL;
+    }
+
+    self->mask = slots - 1u;
+    self->size = size;
+    self->stride = stride;
+
+    for (size_t i = 0; i < slots; ++i) atomic_init((_Atomic(size_t)*)(self->cells + (i * stride)), i);
+
+    atomic_init(&self->tail, 0);
+    atomic_init(&self->head, 0);
+    atomic_init(&self->readable.state, 0);
+    atomic_init(&self->writable.state, 0);
+
+    return (wyt_mpmc_t)self;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_mpmc_destroy(wyt_mpmc_t const mpmc)
+{
+    WYT_ASSUME(mpmc != NULL);
+    struct wyt_mpmc_impl_t* const self = (struct wyt_mpmc_impl_t*)mpmc;
+    wyt_backend_free(self->cells);
+    wyt_backend_free(self);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_bool_t wyt_mpmc_try_push(wyt_mpmc_t const mpmc, const void* const element)
+{
+    WYT_ASSUME(mpmc != NULL);
+    WYT_ASSUME(element != NULL);
+    struct wyt_mpmc_impl_t* const self = (struct wyt_mpmc_impl_t*)mpmc;
+
+    /// @see atomic_load_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_load
+    size_t pos = atomic_load_explicit(&self->tail, memory_order_relaxed);
+    unsigned char* cell;
+    for (;;)
+    {
+        cell = self->cells + ((pos & self->mask) * self->stride);
+        const size_t seq = atomic_load_explicit((_Atomic(size_t)*)cell, memory_order_acquire);
+
+        if (seq == pos)
+        {
+            /// @see atomic_compare_exchange_weak_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_compare_exchange
+            if (atomic_compare_exchange_weak_explicit(&self->tail, &pos, pos + 1u, memory_order_relaxed, memory_order_relaxed)) break;
+        }
+        else if ((ptrdiff_t)(seq - pos) < 0)
+        {
+            // The cell still holds the element from the previous lap, so the queue is full.
+            return false;
+        }
+        else
+        {
+            pos = atomic_load_explicit(&self->tail, memory_order_relaxed);
+        }
+    }
+
+    /// @see memcpy | <string.h> [libc] (C89) | https://en.cppreference.com/w/c/string/byte/memcpy
+    memcpy(cell + sizeof(_Atomic(size_t)), element, self->size);
+
+    /// @see atomic_store_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_store
+    atomic_store_explicit((_Atomic(size_t)*)cell, pos + 1u, memory_order_release);
+    wyt_evcount_notify((wyt_evcount_t)&self->readable);
+
+    return true;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_bool_t wyt_mpmc_try_pop(wyt_mpmc_t const mpmc, void* const element)
+{
+    WYT_ASSUME(mpmc != NULL);
+    WYT_ASSUME(element != NULL);
+    struct wyt_mpmc_impl_t* const self = (struct wyt_mpmc_impl_t*)mpmc;
+
+    /// @see atomic_load_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_load
+    size_t pos = atomic_load_explicit(&self->head, memory_order_relaxed);
+    unsigned char* cell;
+    for (;;)
+    {
+        cell = self->cells + ((pos & self->mask) * self->stride);
+        const size_t seq = atomic_load_explicit((_Atomic(size_t)*)cell, memory_order_acquire);
+
+        if (seq == pos + 1u)
+        {
+            /// @see atomic_compare_exchange_weak_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_compare_exchange
+            if (atomic_compare_exchange_weak_explicit(&self->head, &pos, pos + 1u, memory_order_relaxed, memory_order_relaxed)) break;
+        }
+        else if ((ptrdiff_t)(seq - (pos + 1u)) < 0)
+        {
+            // The cell has not been pushed into during this lap, so the queue is empty.
+            return false;
+        }
+        else
+        {
+            pos = atomic_load_explicit(&self->head, memory_order_relaxed);
+        }
+    }
+
+    /// @see memcpy | <string.h> [libc] (C89) | https://en.cppreference.com/w/c/string/byte/memcpy
+    memcpy(element, cell + sizeof(_Atomic(size_t)), self->size);
+
+    // Marks the cell as ready to be pushed into during the next lap.
+    /// @see atomic_store_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_store
+    atomic_store_explicit((_Atomic(size_t)*)cell, pos + self->mask + 1u, memory_order_release);
+    wyt_evcount_notify((wyt_evcount_t)&self->writable);
+
+    return true;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_bool_t wyt_mpmc_push(wyt_mpmc_t const mpmc, const void* const element, wyt_utime_t const deadline)
+{
+    WYT_ASSUME(mpmc != NULL);
+    struct wyt_mpmc_impl_t* const self = (struct wyt_mpmc_impl_t*)mpmc;
+
+    for (;;)
+    {
+        if (wyt_mpmc_try_push(mpmc, element)) return true;
+
+        const wyt_word_t key = wyt_evcount_prepare((wyt_evcount_t)&self->writable);
+        if (wyt_mpmc_try_push(mpmc, element)) return true;
+
+        if (!wyt_evcount_wait((wyt_evcount_t)&self->writable, key, deadline)) return wyt_mpmc_try_push(mpmc, element);
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_bool_t wyt_mpmc_pop(wyt_mpmc_t const mpmc, void* const element, wyt_utime_t const deadline)
+{
+    WYT_ASSUME(mpmc != NULL);
+    struct wyt_mpmc_impl_t* const self = (struct wyt_mpmc_impl_t*)mpmc;
+
+    for (;;)
+    {
+        if (wyt_mpmc_try_pop(mpmc, element)) return true;
+
+        const wyt_word_t key = wyt_evcount_prepare((wyt_evcount_t)&self->readable);
+        if (wyt_mpmc_try_pop(mpmc, element)) return true;
+
+        if (!wyt_evcount_wait((wyt_evcount_t)&self->readable, key, deadline)) return wyt_mpmc_try_pop(mpmc, element);
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_triple_buffer_t wyt_triple_buffer_create(size_t const size)
+{
+    if ((size == 0) || (size > (SIZE_MAX / 3u) - 2u * WYT_PADDING)) return NULL;
+
+    // Slots are padded and aligned so that the writer and reader never touch the same cache lines.
+    const size_t stride = ((size + WYT_PADDING - 1u) / WYT_PADDING) * WYT_PADDING;
+    struct wyt_triple_buffer_impl_t* const self = wyt_backend_alloc(sizeof(struct wyt_triple_buffer_impl_t));
+    if (self == NULL) return NULL;
+    self->block = wyt_backend_alloc(3u * stride + WYT_PADDING - 1u);
+    if (self->block == NULL)
+    {
+        wyt_backend_free(self);
+        return NULL;
+    }
+
+    const uintptr_t base = ((uintptr_t)self->block + (WYT_PADDING - 1u)) & ~(uintptr_t)(WYT_PADDING - 1u);
+    self->slots = (unsigned char*)base;
+
+    /// @see memset | <string.h> [libc] (C89) | https://en.cppreference.com/w/c/string/byte/memset
+    memset(self->slots, 0, 3u * stride);
+
+    self->stride = stride;
+    self->back = 0;
+    atomic_init(&self->middle, 1u);
+    self->front = 2;
+
+    return (wyt_triple_buffer_t)self;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_triple_buffer_destroy(wyt_triple_buffer_t const buffer)
+{
+    WYT_ASSUME(buffer != NULL);
+    struct wyt_triple_buffer_impl_t* const self = (struct wyt_triple_buffer_impl_t*)buffer;
+    wyt_backend_free(self->block);
+    wyt_backend_free(self);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void* wyt_triple_buffer_write(wyt_triple_buffer_t const buffer)
+{
+    WYT_ASSUME(buffer != NULL);
+    struct wyt_triple_buffer_impl_t* const self = (struct wyt_triple_buffer_impl_t*)buffer;
+
+    return self->slots + (self->back * self->stride);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_triple_buffer_publish(wyt_triple_buffer_t const buffer)
+{
+    WYT_ASSUME(buffer != NULL);
+    struct wyt_triple_buffer_impl_t* const self = (struct wyt_triple_buffer_impl_t*)buffer;
+
+    // Release publishes the slot's contents. Acquire ensures the reader has finished with the slot that is taken in return.
+    /// @see atomic_exchange_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_exchange
+    const unsigned int prev = atomic_exchange_explicit(&self->middle, self->back | WYT_TRIPLE_DIRTY, memory_order_acq_rel);
+    self->back = prev & ~WYT_TRIPLE_DIRTY;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern const void* wyt_triple_buffer_read(wyt_triple_buffer_t const buffer, wyt_bool_t* const updated)
+{
+    WYT_ASSUME(buffer != NULL);
+    struct wyt_triple_buffer_impl_t* const self = (struct wyt_triple_buffer_impl_t*)buffer;
+
+    // The exchange is skipped when nothing new has been published, so an idle reader does not take the cache line away from the writer.
+    /// @see atomic_load_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_load
+    const wyt_bool_t dirty = (atomic_load_explicit(&self->middle, memory_order_relaxed) & WYT_TRIPLE_DIRTY) != 0;
+    if (dirty)
+    {
+        /// @see atomic_exchange_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_exchange
+        const unsigned int prev = atomic_exchange_explicit(&self->middle, self->front, memory_order_acq_rel);
+        self->front = prev & ~WYT_TRIPLE_DIRTY;
+    }
+
+    if (updated != NULL) *updated = dirty;
+    return self->slots + (self->front * self->stride);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_seqlock_t wyt_seqlock_create(size_t const size)
+{
+    const size_t word = sizeof(_Atomic(size_t));
+    if ((size == 0) || (size > SIZE_MAX - sizeof(struct wyt_seqlock_impl_t) - word)) return NULL;
+
+    const size_t count = (size + word - 1u) / word;
+    struct wyt_seqlock_impl_t* const self = wyt_backend_alloc(sizeof(struct wyt_seqlock_impl_t) + (count * word));
+    if (self == NULL) return NULL;
+
+    atomic_init(&self->seq, 0);
+    self->size = size;
+    for (size_t i = 0; i < count; ++i) atomic_init(&self->words[i], 0);
+
+    return (wyt_seqlock_t)self;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_seqlock_destroy(wyt_seqlock_t const seqlock)
+{
+    WYT_ASSUME(seqlock != NULL);
+    wyt_backend_free(seqlock);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_seqlock_write(wyt_seqlock_t const seqlock, const void* const value)
+{
+    WYT_ASSUME(seqlock != NULL);
+    WYT_ASSUME(value != NULL);
+    struct wyt_seqlock_impl_t* const self = (struct wyt_seqlock_impl_t*)seqlock;
+
+    // Claims the lock by making the sequence odd. Acquire orders this write after the previous writer's.
+    /// @see atomic_load_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_load
+    size_t seq = atomic_load_explicit(&self->seq, memory_order_relaxed);
+    for (unsigned int spins = 0; ; ++spins)
+    {
+        /// @see atomic_compare_exchange_weak_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_compare_exchange
+        if (((seq & 1u) == 0) && atomic_compare_exchange_weak_explicit(&self->seq, &seq, seq + 1u, memory_order_acquire, memory_order_relaxed)) break;
+
+        if (spins < 64u) WYT_PAUSE(); else wyt_yield();
+        seq = atomic_load_explicit(&self->seq, memory_order_relaxed);
+    }
+
+    // Keeps the stores to the value from becoming visible before the sequence turns odd.
+    /// @see atomic_thread_fence | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_thread_fence
+    atomic_thread_fence(memory_order_release);
+
+    const size_t word = sizeof(_Atomic(size_t));
+    for (size_t i = 0, offset = 0; offset < self->size; ++i, offset += word)
+    {
+        const size_t len = (self->size - offset < word) ? (self->size - offset) : word;
+
+        size_t bits = 0;
+        /// @see memcpy | <string.h> [libc] (C89) | https://en.cppreference.com/w/c/string/byte/memcpy
+        memcpy(&bits, (const unsigned char*)value + offset, len);
+        /// @see atomic_store_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_store
+        atomic_store_explicit(&self->words[i], bits, memory_order_relaxed);
+    }
+
+    atomic_store_explicit(&self->seq, seq + 2u, memory_order_release);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_seqlock_read(wyt_seqlock_t const seqlock, void* const value)
+{
+    WYT_ASSUME(seqlock != NULL);
+    WYT_ASSUME(value != NULL);
+    struct wyt_seqlock_impl_t* const self = (struct wyt_seqlock_impl_t*)seqlock;
+
+    const size_t word = sizeof(_Atomic(size_t));
+    for (unsigned int spins = 0; ; ++spins)
+    {
+        /// @see atomic_load_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_load
+        const size_t before = atomic_load_explicit(&self->seq, memory_order_acquire);
+        if ((before & 1u) == 0)
+        {
+            for (size_t i = 0, offset = 0; offset < self->size; ++i, offset += word)
+            {
+                const size_t len = (self->size - offset < word) ? (self->size - offset) : word;
+                const size_t bits = atomic_load_explicit(&self->words[i], memory_order_relaxed);
+
+                /// @see memcpy | <string.h> [libc] (C89) | https://en.cppreference.com/w/c/string/byte/memcpy
+                memcpy((unsigned char*)value + offset, &bits, len);
+            }
+
+            // Keeps the loads of the value from being satisfied after the sequence is re-checked.
+            /// @see atomic_thread_fence | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_thread_fence
+            atomic_thread_fence(memory_order_acquire);
+
+            const size_t after = atomic_load_explicit(&self->seq, memory_order_relaxed);
+            if (before == after) return;
+        }
+
+        if (spins < 64u) WYT_PAUSE(); else wyt_yield();
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_ebr_t wyt_ebr_create(size_t const backlog)
+{
+    if (backlog == 0) return NULL;
+    struct wyt_ebr_impl_t* const self = wyt_backend_alloc(sizeof(struct wyt_ebr_impl_t));
+    if (self == NULL) return NULL;
+
+    atomic_init(&self->epoch, 0);
+    atomic_init(&self->lock, 0);
+    self->records = NULL;
+    self->orphans = NULL;
+    self->backlog = backlog;
+
+    return (wyt_ebr_t)self;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_ebr_destroy(wyt_ebr_t const ebr)
+{
+    WYT_ASSUME(ebr != NULL);
+    struct wyt_ebr_impl_t* const self = (struct wyt_ebr_impl_t*)ebr;
+    WYT_ASSUME(self->records == NULL);
+
+    while (self->orphans != NULL)
+    {
+        struct wyt_ebr_chunk_t* const chunk = self->orphans;
+        self->orphans = chunk->next;
+
+        wyt_ebr_reclaim_chunk(chunk);
+        wyt_backend_free(chunk);
+    }
+
+    wyt_backend_free(self);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_ebr_thread_t wyt_ebr_register(wyt_ebr_t const ebr)
+{
+    WYT_ASSUME(ebr != NULL);
+    struct wyt_ebr_impl_t* const self = (struct wyt_ebr_impl_t*)ebr;
+    struct wyt_ebr_record_t* const rec = wyt_backend_alloc(sizeof(struct wyt_ebr_record_t));
+    if (rec == NULL) return NULL;
+
+    atomic_init(&rec->local, 0);
+    rec->domain = self;
+    rec->depth = 0;
+    rec->pending = 0;
+    rec->bag = NULL;
+    rec->oldest = NULL;
+    rec->youngest = NULL;
+    rec->spare = NULL;
+    rec->spares = 0;
+
+    wyt_lock_acquire(&self->lock);
+    rec->next = self->records;
+    self->records = rec;
+    wyt_lock_release(&self->lock);
+
+    return (wyt_ebr_thread_t)rec;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_ebr_unregister(wyt_ebr_thread_t const thread)
+{
+    WYT_ASSUME(thread != NULL);
+    struct wyt_ebr_record_t* const rec = (struct wyt_ebr_record_t*)thread;
+    struct wyt_ebr_impl_t* const self = rec->domain;
+    WYT_ASSUME(rec->depth == 0);
+
+    wyt_ebr_seal(rec);
+    wyt_ebr_collect(rec);
+
+    wyt_lock_acquire(&self->lock);
+
+    struct wyt_ebr_record_t** link = &self->records;
+    while (*link != rec) link = &(*link)->next;
+    *link = rec->next;
+
+    if (rec->youngest != NULL)
+    {
+        rec->youngest->next = self->orphans;
+        self->orphans = rec->oldest;
+    }
+
+    wyt_lock_release(&self->lock);
+    wyt_backend_free(rec->bag);
+    while (rec->spare != NULL)
+    {
+        struct wyt_ebr_chunk_t* const chunk = rec->spare;
+        rec->spare = chunk->next;
+        wyt_backend_free(chunk);
+    }
+    wyt_backend_free(rec);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_ebr_enter(wyt_ebr_thread_t const thread)
+{
+    WYT_ASSUME(thread != NULL);
+    struct wyt_ebr_record_t* const rec = (struct wyt_ebr_record_t*)thread;
+
+    if (rec->depth++ != 0) return;
+
+    /// @see atomic_load_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_load
+    const size_t epoch = atomic_load_explicit(&rec->domain->epoch, memory_order_relaxed);
+    /// @see atomic_store_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_store
+    atomic_store_explicit(&rec->local, (epoch << 1) | 1u, memory_order_relaxed);
+
+    // Keeps the announcement from being reordered after the loads of the critical section.
+    /// @see atomic_thread_fence | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_thread_fence
+    atomic_thread_fence(memory_order_seq_cst);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_ebr_leave(wyt_ebr_thread_t const thread)
+{
+    WYT_ASSUME(thread != NULL);
+    struct wyt_ebr_record_t* const rec = (struct wyt_ebr_record_t*)thread;
+    WYT_ASSUME(rec->depth > 0);
+
+    if (--rec->depth != 0) return;
+
+    /// @see atomic_store_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_store
+    atomic_store_explicit(&rec->local, 0, memory_order_release);
+
+    if (rec->pending >= rec->domain->backlog) wyt_ebr_drain(rec, rec->domain->backlog / 2u);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_ebr_retire(wyt_ebr_thread_t const thread, void* const ptr, wyt_ebr_reclaim_t const reclaim)
+{
+    WYT_ASSUME(thread != NULL);
+    WYT_ASSUME(reclaim != NULL);
+    struct wyt_ebr_record_t* const rec = (struct wyt_ebr_record_t*)thread;
+
+    struct wyt_ebr_chunk_t* bag = rec->bag;
+    if (bag == NULL)
+    {
+        if (rec->spare != NULL)
+        {
+            bag = rec->spare;
+            rec->spare = bag->next;
+            rec->spares -= 1;
+        }
+        else
+        {
+            // Retiring has no way to report failure, and the object cannot be reclaimed safely without a chunk to hold it.
+            bag = wyt_backend_alloc(sizeof(struct wyt_ebr_chunk_t));
+            WYT_ASSERT(bag != NULL);
+        }
+
+        bag->count = 0;
+        rec->bag = bag;
+    }
+
+    bag->items[bag->count].ptr = ptr;
+    bag->items[bag->count].reclaim = reclaim;
+    bag->count += 1;
+    rec->pending += 1;
+
+    if (bag->count == WYT_EBR_CHUNK)
+    {
+        wyt_ebr_seal(rec);
+        (void)wyt_ebr_advance(rec->domain);
+        wyt_ebr_collect(rec);
+    }
+
+    if ((rec->pending >= rec->domain->backlog) && (rec->depth == 0)) wyt_ebr_drain(rec, rec->domain->backlog / 2u);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_ebr_flush(wyt_ebr_thread_t const thread)
+{
+    WYT_ASSUME(thread != NULL);
+    struct wyt_ebr_record_t* const rec = (struct wyt_ebr_record_t*)thread;
+    WYT_ASSUME(rec->depth == 0);
+
+    wyt_ebr_drain(rec, 0);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_bool_t wyt_fiber_spawn(wyt_fiber_entry_t const func, void* const arg, size_t const stack_size)
+{
+    WYT_ASSUME(func != NULL);
+    struct wyt_fiber_task_t* const task = wyt_backend_alloc(sizeof(struct wyt_fiber_task_t));
+    if (task == NULL) return false;
+
+    task->fiber = wyt_fiber_create(wyt_fiber_main, task, stack_size);
+    if (task->fiber == NULL)
+    {
+        wyt_backend_free(task);
+        return false;
+    }
+
+    task->func = func;
+    task->arg = arg;
+    task->done = false;
+    wyt_fiber_enqueue(task);
+    return true;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_fiber_run(void)
+{
+    WYT_ASSUME(wyt_fiber_sched.running == NULL);
+
+    wyt_fiber_sched.home = wyt_fiber_current();
+
+    while (wyt_fiber_sched.head != NULL)
+    {
+        struct wyt_fiber_task_t* const task = wyt_fiber_sched.head;
+        wyt_fiber_sched.head = task->next;
+        if (wyt_fiber_sched.head == NULL) wyt_fiber_sched.tail = NULL;
+        wyt_fiber_sched.ready -= 1;
+
+        // The task re-enqueues itself before switching back, unless it has returned.
+        wyt_fiber_sched.running = task;
+        wyt_fiber_switch(task->fiber);
+        wyt_fiber_sched.running = NULL;
+
+        if (task->done)
+        {
+            wyt_fiber_destroy(task->fiber);
+            wyt_backend_free(task);
+        }
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_fiber_yield(void)
+{
+    struct wyt_fiber_task_t* const task = wyt_fiber_sched.running;
+    if (task == NULL)
+    {
+        wyt_yield();
+        return;
+    }
+
+    wyt_fiber_enqueue(task);
+    wyt_fiber_switch(wyt_fiber_sched.home);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_bool_t wyt_fiber_wait(const wyt_word_t* const address, wyt_word_t const expected, wyt_utime_t const deadline)
+{
+    WYT_ASSUME(address != NULL);
+
+    if (wyt_fiber_sched.running == NULL) return wyt_wait(address, expected, deadline);
+
+    const _Atomic(wyt_word_t)* const word = (const _Atomic(wyt_word_t)*)address;
+    wyt_bool_t result = true;
+
+    wyt_fiber_sched.waiting += 1;
+    while (atomic_load_explicit(word, memory_order_acquire) == expected)
+    {
+        const wyt_utime_t now = wyt_nanotime();
+        if (now >= deadline)
+        {
+            result = false;
+            break;
+        }
+
+        // Waiting fibers stay in the run queue, so if it holds nothing else, no fiber on this thread can change the word.
+        if (wyt_fiber_sched.ready + 1 == wyt_fiber_sched.waiting)
+        {
+            if (wyt_fiber_sched.ready == 0)
+            {
+                (void)wyt_wait(address, expected, deadline);
+                continue;
+            }
+
+            const wyt_utime_t limit = (deadline - now > WYT_FIBER_POLL) ? now + WYT_FIBER_POLL : deadline;
+            (void)wyt_wait(address, expected, limit);
+        }
+
+        wyt_fiber_yield();
+    }
+    wyt_fiber_sched.waiting -= 1;
+
+    return result;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_workers_t wyt_workers_create(unsigned int const count, size_t const capacity)
+{
+    WYT_ASSUME(count > 0);
+    WYT_ASSUME(capacity > 0);
+    struct wyt_workers_impl_t* const self = wyt_backend_alloc(sizeof(struct wyt_workers_impl_t) + count * sizeof(wyt_thread_t));
+    if (self == NULL) return NULL;
+
+    // Every worker needs room for the item that stops it.
+    self->queue = wyt_mpmc_create((capacity > count) ? capacity : count, sizeof(struct wyt_work_t));
+    if (self->queue == NULL)
+    {
+        wyt_backend_free(self);
+        return NULL;
+    }
+
+    for (self->count = 0; self->count < count; ++self->count)
+    {
+        self->threads[self->count] = wyt_spawn(wyt_workers_main, self);
+        if (self->threads[self->count] == NULL)
+        {
+            wyt_workers_destroy(self);
+            return NULL;
+        }
+    }
+
+    return self;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_workers_destroy(wyt_workers_t const workers)
+{
+    WYT_ASSUME(workers != NULL);
+    struct wyt_workers_impl_t* const self = (struct wyt_workers_impl_t*)workers;
+    WYT_ASSUME(wyt_workers_self != self);
+
+    // The stop items queue up behind the remaining work, so every submitted item runs first.
+    const struct wyt_work_t stop = { .func = NULL, .userdata = NULL };
+    for (unsigned int i = 0; i < self->count; ++i) (void)wyt_mpmc_push(self->queue, &stop, WYT_FOREVER);
+    for (unsigned int i = 0; i < self->count; ++i) (void)wyt_join(self->threads[i]);
+
+    wyt_mpmc_destroy(self->queue);
+    wyt_backend_free(self);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_workers_submit(wyt_workers_t const workers, wyt_work_callback_t const func, void* const userdata)
+{
+    WYT_ASSUME(workers != NULL);
+    WYT_ASSUME(func != NULL);
+    struct wyt_workers_impl_t* const self = (struct wyt_workers_impl_t*)workers;
+
+    const struct wyt_work_t work = { .func = func, .userdata = userdata };
+    if (wyt_mpmc_try_push(self->queue, &work)) return;
+
+    // A worker blocking on its own full queue could leave no thread to drain it.
+    if (wyt_workers_self == self)
+    {
+        func(userdata);
+        return;
+    }
+
+    (void)wyt_mpmc_push(self->queue, &work, WYT_FOREVER);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_graph_t wyt_graph_create(wyt_workers_t const workers)
+{
+    WYT_ASSUME(workers != NULL);
+    struct wyt_graph_impl_t* const self = wyt_backend_alloc(sizeof(struct wyt_graph_impl_t));
+    if (self == NULL) return NULL;
+
+    self->workers = (struct wyt_workers_impl_t*)workers;
+    self->nodes = NULL;
+    self->count = 0;
+    self->capacity = 0;
+    atomic_init(&self->remaining, 0u);
+    return self;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_graph_destroy(wyt_graph_t const graph)
+{
+    WYT_ASSUME(graph != NULL);
+    struct wyt_graph_impl_t* const self = (struct wyt_graph_impl_t*)graph;
+    WYT_ASSUME(atomic_load_explicit(&self->remaining, memory_order_relaxed) == 0);
+    for (unsigned int i = 0; i < self->count; ++i) wyt_backend_free(self->nodes[i].successors);
+    wyt_backend_free(self->nodes);
+    wyt_backend_free(self);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_graph_node_t wyt_graph_add(wyt_graph_t const graph, wyt_work_callback_t const func, void* const userdata)
+{
+    WYT_ASSUME(graph != NULL);
+    WYT_ASSUME(func != NULL);
+    struct wyt_graph_impl_t* const self = (struct wyt_graph_impl_t*)graph;
+
+    if (self->count == self->capacity)
+    {
+        const unsigned int capacity = (self->capacity != 0) ? self->capacity * 2u : 16u;
+        const size_t bytes = (size_t)capacity * sizeof(struct wyt_graph_node_impl_t);
+        if ((capacity <= self->capacity) || (bytes / sizeof(struct wyt_graph_node_impl_t) != capacity)) return 0;
+        struct wyt_graph_node_impl_t* const nodes = wyt_backend_realloc(self->nodes, bytes);
+        if (nodes == NULL) return 0;
+
+        self->nodes = nodes;
+        self->capacity = capacity;
+    }
+
+    struct wyt_graph_node_impl_t* const node = &self->nodes[self->count];
+    node->func = func;
+    node->userdata = userdata;
+    node->graph = self;
+    node->successors = NULL;
+    node->successor_count = 0;
+    node->successor_capacity = 0;
+    node->dependencies = 0;
+    atomic_init(&node->pending, 0u);
+
+    return ++self->count;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_bool_t wyt_graph_depend(wyt_graph_t const graph, wyt_graph_node_t const node, wyt_graph_node_t const dependency)
+{
+    WYT_ASSUME(graph != NULL);
+    struct wyt_graph_impl_t* const self = (struct wyt_graph_impl_t*)graph;
+    WYT_ASSUME((node != 0) && (node <= self->count));
+    WYT_ASSUME((dependency != 0) && (dependency <= self->count));
+    WYT_ASSUME(node != dependency);
+
+    struct wyt_graph_node_impl_t* const first = &self->nodes[dependency - 1];
+    if (first->successor_count == first->successor_capacity)
+    {
+        const unsigned int capacity = (first->successor_capacity != 0) ? first->successor_capacity * 2u : 4u;
+        const size_t bytes = (size_t)capacity * sizeof(unsigned int);
+        if ((capacity <= first->successor_capacity) || (bytes / sizeof(unsigned int) != capacity)) return false;
+        unsigned int* const successors = wyt_backend_realloc(first->successors, bytes);
+        if (successors == NULL) return false;
+
+        first->successors = successors;
+        first->successor_capacity = capacity;
+    }
+
+    first->successors[first->successor_count++] = node - 1;
+    self->nodes[node - 1].dependencies += 1;
+    return true;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_graph_run(wyt_graph_t const graph)
+{
+    WYT_ASSUME(graph != NULL);
+    struct wyt_graph_impl_t* const self = (struct wyt_graph_impl_t*)graph;
+    if (self->count == 0) return;
+
+    // Submitting a node publishes these stores to the thread that runs it.
+    for (unsigned int i = 0; i < self->count; ++i)
+    {
+        atomic_store_explicit(&self->nodes[i].pending, self->nodes[i].dependencies, memory_order_relaxed);
+    }
+    atomic_store_explicit(&self->remaining, self->count, memory_order_relaxed);
+
+    // The last root runs on this thread, rather than making a round-trip through the queue.
+    struct wyt_graph_node_impl_t* root = NULL;
+    for (unsigned int i = 0; i < self->count; ++i)
+    {
+        if (self->nodes[i].dependencies != 0) continue;
+
+        if (root != NULL) wyt_workers_submit(self->workers, wyt_graph_exec, root);
+        root = &self->nodes[i];
+    }
+    WYT_ASSUME(root != NULL);
+    wyt_graph_exec(root);
+
+    for (;;)
+    {
+        /// @see atomic_load_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_load
+        const wyt_word_t remaining = atomic_load_explicit(&self->remaining, memory_order_acquire);
+        if (remaining == 0) return;
+
+        struct wyt_work_t work;
+        if (wyt_mpmc_try_pop(self->workers->queue, &work))
+        {
+            // Stop items are only queued by `wyt_workers_destroy`, which must not run concurrently.
+            WYT_ASSUME(work.func != NULL);
+            work.func(work.userdata);
+            continue;
+        }
+
+        (void)wyt_wait(WYT_WORD(&self->remaining), remaining, WYT_FOREVER);
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_future_t wyt_future_create(void)
+{
+    return wyt_future_alloc(1u);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_future_retain(wyt_future_t const future)
+{
+    WYT_ASSUME(future != NULL);
+    struct wyt_future_impl_t* const self = (struct wyt_future_impl_t*)future;
+
+    /// @see atomic_fetch_add_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_fetch_add
+    const wyt_word_t prev = atomic_fetch_add_explicit(&self->refs, 1u, memory_order_relaxed);
+    WYT_ASSUME(prev != 0);
+    (void)prev;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_future_release(wyt_future_t const future)
+{
+    WYT_ASSUME(future != NULL);
+    struct wyt_future_impl_t* const self = (struct wyt_future_impl_t*)future;
+
+    /// @see atomic_fetch_sub_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_fetch_sub
+    if (atomic_fetch_sub_explicit(&self->refs, 1u, memory_order_acq_rel) != 1u) return;
+
+    WYT_ASSUME((atomic_load_explicit(&self->dependents, memory_order_relaxed) & ~WYT_FUTURE_DONE) == 0);
+
+    wyt_lock_acquire(&wyt_future_lock);
+    self->next = wyt_future_pool;
+    wyt_future_pool = self;
+    wyt_lock_release(&wyt_future_lock);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_future_complete(wyt_future_t const future, void* const value)
+{
+    WYT_ASSUME(future != NULL);
+    struct wyt_future_impl_t* const self = (struct wyt_future_impl_t*)future;
+    WYT_ASSUME(self->func == NULL);
+
+    struct wyt_future_impl_t* pending = NULL;
+    wyt_future_settle(self, value, &pending);
+    wyt_future_run(pending);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_bool_t wyt_future_ready(wyt_future_t const future)
+{
+    WYT_ASSUME(future != NULL);
+    struct wyt_future_impl_t* const self = (struct wyt_future_impl_t*)future;
+
+    /// @see atomic_load_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_load
+    return atomic_load_explicit(&self->state, memory_order_acquire) == WYT_FUTURE_READY;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_bool_t wyt_future_wait(wyt_future_t const future, wyt_utime_t const deadline)
+{
+    WYT_ASSUME(future != NULL);
+    struct wyt_future_impl_t* const self = (struct wyt_future_impl_t*)future;
+
+    /// @see atomic_load_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_load
+    wyt_word_t state = atomic_load_explicit(&self->state, memory_order_acquire);
+    while (state != WYT_FUTURE_READY)
+    {
+        // Announce the sleeper, so that completing only makes a system call when someone is waiting.
+        /// @see atomic_compare_exchange_weak_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_compare_exchange
+        if ((state == WYT_FUTURE_PENDING) && !atomic_compare_exchange_weak_explicit(&self->state, &state, WYT_FUTURE_SLEEPING, memory_order_acquire, memory_order_acquire)) continue;
+
+        if (!wyt_wait(WYT_WORD(&self->state), WYT_FUTURE_SLEEPING, deadline))
+        {
+            return atomic_load_explicit(&self->state, memory_order_acquire) == WYT_FUTURE_READY;
+        }
+        state = atomic_load_explicit(&self->state, memory_order_acquire);
+    }
+    return true;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void* wyt_future_value(wyt_future_t const future)
+{
+    WYT_ASSUME(future != NULL);
+    struct wyt_future_impl_t* const self = (struct wyt_future_impl_t*)future;
+    WYT_ASSUME(atomic_load_explicit(&self->state, memory_order_acquire) == WYT_FUTURE_READY);
+
+    return self->value;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_future_t wyt_future_then(wyt_future_t const future, wyt_future_callback_t const func, void* const userdata, wyt_workers_t const workers)
+{
+    WYT_ASSUME(future != NULL);
+    WYT_ASSUME(func != NULL);
+    struct wyt_future_impl_t* const self = (struct wyt_future_impl_t*)future;
+
+    // One reference for the caller, and one for the continuation until it has run.
+    struct wyt_future_impl_t* const cont = wyt_future_alloc(2u);
+    if (cont == NULL) return NULL;
+
+    cont->func = func;
+    cont->userdata = userdata;
+    cont->workers = workers;
+
+    /// @see atomic_load_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_load
+    uintptr_t list = atomic_load_explicit(&self->dependents, memory_order_acquire);
+    for (;;)
+    {
+        if (list == WYT_FUTURE_DONE)
+        {
+            cont->input = self->value;
+            wyt_future_dispatch(cont);
+            return cont;
+        }
+
+        cont->next = (struct wyt_future_impl_t*)list;
+
+        /// @see atomic_compare_exchange_weak_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_compare_exchange
+        if (atomic_compare_exchange_weak_explicit(&self->dependents, &list, (uintptr_t)cont, memory_order_release, memory_order_acquire)) return cont;
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_pool_t wyt_pool_create(size_t const size, size_t const align)
+{
+    WYT_ASSUME((align != 0) && ((align & (align - 1u)) == 0));
+
+    // Free objects hold a link, which must fit and be aligned.
+    const size_t link = sizeof(void*);
+    const size_t alignment = (align > link) ? align : link;
+    const size_t length = (size > link) ? size : link;
+    if (length > SIZE_MAX - alignment) return NULL;
+    struct wyt_pool_impl_t* const self = wyt_backend_alloc(sizeof(struct wyt_pool_impl_t));
+    if (self == NULL) return NULL;
+
+    self->size = size;
+    self->align = alignment;
+    self->stride = (length + alignment - 1u) & ~(alignment - 1u);
+
+    wyt_lock_acquire(&wyt_pool_lock);
+    self->id = ++wyt_pool_ids;
+    self->slot = WYT_POOL_CACHES;
+    for (unsigned int slot = 0; slot < WYT_POOL_CACHES; ++slot)
+    {
+        if ((wyt_pool_slots & (1u << slot)) == 0)
+        {
+            wyt_pool_slots |= 1u << slot;
+            wyt_pool_live[slot] = self;
+            self->slot = slot;
+            break;
+        }
+    }
+    wyt_lock_release(&wyt_pool_lock);
+
+    /// @see atomic_init | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_init
+    atomic_init(&self->head, (uint64_t)0);
+    atomic_init(&self->lock, 0u);
+    atomic_init(&self->slab_count, 0u);
+    atomic_init(&self->allocs, (size_t)0);
+    atomic_init(&self->cache_hits, (size_t)0);
+    atomic_init(&self->global_hits, (size_t)0);
+    return self;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_pool_destroy(wyt_pool_t const pool)
+{
+    WYT_ASSUME(pool != NULL);
+    struct wyt_pool_impl_t* const self = (struct wyt_pool_impl_t*)pool;
+
+    // Caches of other threads still referring to this pool are discarded on their next use, since a new pool never reuses the ID.
+    struct wyt_pool_cache_t* const cache = (self->slot < WYT_POOL_CACHES) ? &wyt_pool_caches[self->slot] : NULL;
+    if ((cache != NULL) && (cache->id == self->id)) cache->id = 0;
+
+    wyt_lock_acquire(&wyt_pool_lock);
+    if (self->slot < WYT_POOL_CACHES)
+    {
+        wyt_pool_slots &= ~(1u << self->slot);
+        wyt_pool_live[self->slot] = NULL;
+    }
+    wyt_lock_release(&wyt_pool_lock);
+
+    const unsigned int count = atomic_load_explicit(&self->slab_count, memory_order_relaxed);
+    for (unsigned int slab = 0; slab < count; ++slab) wyt_backend_free(self->blocks[slab]);
+    wyt_backend_free(self);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void* wyt_pool_alloc(wyt_pool_t const pool)
+{
+    WYT_ASSUME(pool != NULL);
+    struct wyt_pool_impl_t* const self = (struct wyt_pool_impl_t*)pool;
+
+    struct wyt_pool_cache_t* const cache = wyt_pool_cache(self);
+    if (cache != NULL)
+    {
+        if (++cache->allocs >= WYT_POOL_TALLY) wyt_pool_tally(self, cache);
+
+        void* const object = cache->head;
+        if (object != NULL)
+        {
+            (void)memcpy(&cache->head, object, sizeof(void*));
+            --cache->count;
+            ++cache->hits;
+            return object;
+        }
+
+        // Refill the cache with a batch, keeping the first object for the caller.
+        void* first = wyt_pool_pop(self);
+        while ((first == NULL) && wyt_pool_grow(self)) first = wyt_pool_pop(self);
+        if (first == NULL) return NULL;
+
+        size_t popped = 1;
+        while (cache->count < WYT_POOL_BATCH)
+        {
+            void* const next = wyt_pool_pop(self);
+            if (next == NULL) break;
+            (void)memcpy(next, &cache->head, sizeof(void*));
+            cache->head = next;
+            ++cache->count;
+            ++popped;
+        }
+
+        /// @see atomic_fetch_add_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_fetch_add
+        (void)atomic_fetch_add_explicit(&self->global_hits, popped, memory_order_relaxed);
+        return first;
+    }
+
+    void* object = wyt_pool_pop(self);
+    while ((object == NULL) && wyt_pool_grow(self)) object = wyt_pool_pop(self);
+    if (object == NULL) return NULL;
+
+    /// @see atomic_fetch_add_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_fetch_add
+    (void)atomic_fetch_add_explicit(&self->allocs, 1u, memory_order_relaxed);
+    (void)atomic_fetch_add_explicit(&self->global_hits, 1u, memory_order_relaxed);
+    return object;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_pool_free(wyt_pool_t const pool, void* const ptr)
+{
+    WYT_ASSUME(pool != NULL);
+    WYT_ASSUME(ptr != NULL);
+    struct wyt_pool_impl_t* const self = (struct wyt_pool_impl_t*)pool;
+
+    struct wyt_pool_cache_t* const cache = wyt_pool_cache(self);
+    if (cache != NULL)
+    {
+        (void)memcpy(ptr, &cache->head, sizeof(void*));
+        cache->head = ptr;
+        if (++cache->count > WYT_POOL_CACHE_MAX) wyt_pool_flush(self, cache, WYT_POOL_BATCH);
+        return;
+    }
+
+    const uint32_t index = wyt_pool_index(self, ptr) + 1u;
+    wyt_pool_push(self, index, (unsigned char*)ptr);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_pool_stats(wyt_pool_t const pool, wyt_pool_stats_t* const stats)
+{
+    WYT_ASSUME(pool != NULL);
+    WYT_ASSUME(stats != NULL);
+    struct wyt_pool_impl_t* const self = (struct wyt_pool_impl_t*)pool;
+
+    if (self->slot < WYT_POOL_CACHES)
+    {
+        struct wyt_pool_cache_t* const cache = &wyt_pool_caches[self->slot];
+        if (cache->id == self->id) wyt_pool_tally(self, cache);
+    }
+
+    /// @see atomic_load_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_load
+    const unsigned int slabs = atomic_load_explicit(&self->slab_count, memory_order_acquire);
+    const size_t objects = (size_t)WYT_POOL_SLAB * (((size_t)1 << slabs) - 1u);
+
+    stats->allocs = atomic_load_explicit(&self->allocs, memory_order_relaxed);
+    stats->cache_hits = atomic_load_explicit(&self->cache_hits, memory_order_relaxed);
+    stats->global_hits = atomic_load_explicit(&self->global_hits, memory_order_relaxed);
+    stats->slabs = slabs;
+    stats->objects = objects;
+    stats->bytes = sizeof(struct wyt_pool_impl_t) + objects * self->stride + slabs * (self->align - 1u);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_bool_t wyt_try_join(wyt_thread_t const thread, wyt_retval_t* const retval)
+{
+    return wyt_join_until(thread, 0, retval);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_chan_t wyt_chan_create(size_t const capacity, size_t const size)
+{
+    struct wyt_chan_impl_t* const self = wyt_backend_alloc(sizeof(struct wyt_chan_impl_t));
+    if (self == NULL) return NULL;
+
+    self->queue = wyt_mpmc_create(capacity, size);
+    if (self->queue == NULL)
+    {
+        wyt_backend_free(self);
+        return NULL;
+    }
+
+    atomic_init(&self->state, 0);
+    atomic_init(&self->selectors, 0);
+
+    return (wyt_chan_t)self;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_chan_destroy(wyt_chan_t const chan)
+{
+    WYT_ASSUME(chan != NULL);
+    struct wyt_chan_impl_t* const self = (struct wyt_chan_impl_t*)chan;
+
+    wyt_mpmc_destroy(self->queue);
+    wyt_backend_free(self);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_chan_close(wyt_chan_t const chan)
+{
+    WYT_ASSUME(chan != NULL);
+    struct wyt_chan_impl_t* const self = (struct wyt_chan_impl_t*)chan;
+    struct wyt_mpmc_impl_t* const queue = (struct wyt_mpmc_impl_t*)self->queue;
+
+    /// @see atomic_fetch_or_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_fetch_or
+    const size_t prev = atomic_fetch_or_explicit(&self->state, WYT_CHAN_CLOSED, memory_order_seq_cst);
+    if ((prev & WYT_CHAN_CLOSED) != 0) return;
+
+    wyt_evcount_notify((wyt_evcount_t)&queue->readable);
+    wyt_evcount_notify((wyt_evcount_t)&queue->writable);
+    wyt_chan_changed(self);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_chan_result_t wyt_chan_try_send(wyt_chan_t const chan, const void* const message)
+{
+    WYT_ASSUME(chan != NULL);
+    struct wyt_chan_impl_t* const self = (struct wyt_chan_impl_t*)chan;
+    struct wyt_mpmc_impl_t* const queue = (struct wyt_mpmc_impl_t*)self->queue;
+
+    /// @see atomic_fetch_add_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_fetch_add
+    const size_t state = atomic_fetch_add_explicit(&self->state, 2u, memory_order_seq_cst);
+    const wyt_bool_t sent = ((state & WYT_CHAN_CLOSED) == 0) && wyt_mpmc_try_push(self->queue, message);
+
+    /// @see atomic_fetch_sub_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_fetch_sub
+    const size_t prev = atomic_fetch_sub_explicit(&self->state, 2u, memory_order_seq_cst);
+
+    // Receivers of a closed channel wait for the sends in progress to finish, so the last one must wake them.
+    if ((prev & WYT_CHAN_CLOSED) != 0) wyt_evcount_notify((wyt_evcount_t)&queue->readable);
+    if (sent || ((prev & WYT_CHAN_CLOSED) != 0)) wyt_chan_changed(self);
+
+    if (sent) return wyt_chan_ok;
+    return ((state & WYT_CHAN_CLOSED) != 0) ? wyt_chan_closed : wyt_chan_timeout;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_chan_result_t wyt_chan_try_recv(wyt_chan_t const chan, void* const message)
+{
+    WYT_ASSUME(chan != NULL);
+    struct wyt_chan_impl_t* const self = (struct wyt_chan_impl_t*)chan;
+
+    if (!wyt_mpmc_try_pop(self->queue, message))
+    {
+        /// @see atomic_load_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_load
+        if (atomic_load_explicit(&self->state, memory_order_seq_cst) != WYT_CHAN_CLOSED) return wyt_chan_timeout;
+
+        // Every send has finished, so the queue now holds every message that will ever be sent.
+        if (!wyt_mpmc_try_pop(self->queue, message)) return wyt_chan_closed;
+    }
+
+    wyt_chan_changed(self);
+    return wyt_chan_ok;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_chan_result_t wyt_chan_send(wyt_chan_t const chan, const void* const message, wyt_utime_t const deadline)
+{
+    WYT_ASSUME(chan != NULL);
+    struct wyt_chan_impl_t* const self = (struct wyt_chan_impl_t*)chan;
+    struct wyt_mpmc_impl_t* const queue = (struct wyt_mpmc_impl_t*)self->queue;
+
+    for (;;)
+    {
+        wyt_chan_result_t res = wyt_chan_try_send(chan, message);
+        if (res != wyt_chan_timeout) return res;
+
+        const wyt_word_t key = wyt_evcount_prepare((wyt_evcount_t)&queue->writable);
+        res = wyt_chan_try_send(chan, message);
+        if (res != wyt_chan_timeout) return res;
+
+        if (!wyt_evcount_wait((wyt_evcount_t)&queue->writable, key, deadline)) return wyt_chan_try_send(chan, message);
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_chan_result_t wyt_chan_recv(wyt_chan_t const chan, void* const message, wyt_utime_t const deadline)
+{
+    WYT_ASSUME(chan != NULL);
+    struct wyt_chan_impl_t* const self = (struct wyt_chan_impl_t*)chan;
+    struct wyt_mpmc_impl_t* const queue = (struct wyt_mpmc_impl_t*)self->queue;
+
+    for (;;)
+    {
+        wyt_chan_result_t res = wyt_chan_try_recv(chan, message);
+        if (res != wyt_chan_timeout) return res;
+
+        const wyt_word_t key = wyt_evcount_prepare((wyt_evcount_t)&queue->readable);
+        res = wyt_chan_try_recv(chan, message);
+        if (res != wyt_chan_timeout) return res;
+
+        if (!wyt_evcount_wait((wyt_evcount_t)&queue->readable, key, deadline)) return wyt_chan_try_recv(chan, message);
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern size_t wyt_select(const wyt_select_case_t* const cases, size_t const count, wyt_utime_t const deadline, wyt_chan_result_t* const result)
+{
+    WYT_ASSUME((cases != NULL) && (count != 0));
+
+    const size_t start = wyt_select_turn++ % count;
+    size_t index = count;
+
+    wyt_chan_result_t res = wyt_select_try(cases, count, start, &index);
+    if ((res == wyt_chan_timeout) && (deadline != 0))
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            struct wyt_chan_impl_t* const self = (struct wyt_chan_impl_t*)cases[i].chan;
+
+            /// @see atomic_fetch_add_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_fetch_add
+            (void)atomic_fetch_add_explicit(&self->selectors, 1u, memory_order_relaxed);
+        }
+
+        // Pairs with the fence of the Event Count notification in every channel operation: either the operation sees the registration, or this thread sees the operation.
+        /// @see atomic_thread_fence | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_thread_fence
+        atomic_thread_fence(memory_order_seq_cst);
+
+        for (;;)
+        {
+            const wyt_word_t key = wyt_evcount_prepare((wyt_evcount_t)&wyt_select_evcount);
+            res = wyt_select_try(cases, count, start, &index);
+            if (res != wyt_chan_timeout) break;
+
+            if (!wyt_evcount_wait((wyt_evcount_t)&wyt_select_evcount, key, deadline))
+            {
+                res = wyt_select_try(cases, count, start, &index);
+                break;
+            }
+        }
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            struct wyt_chan_impl_t* const self = (struct wyt_chan_impl_t*)cases[i].chan;
+
+            /// @see atomic_fetch_sub_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_fetch_sub
+            (void)atomic_fetch_sub_explicit(&self->selectors, 1u, memory_order_relaxed);
+        }
+    }
+
+    if (result != NULL) *result = res;
+    return (res != wyt_chan_timeout) ? index : count;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_thread_t wyt_spawn_pooled(wyt_entry_t const func, void* const arg)
+{
+    WYT_ASSUME(func != NULL);
+
+    struct wyt_task_t* const task = wyt_backend_alloc(sizeof(struct wyt_task_t));
+    if (task == NULL) return NULL;
+
+    task->func = func;
+    task->arg = arg;
+    task->retval = (wyt_retval_t)0;
+    task->state = 0;
+
+    wyt_lock_acquire(&wyt_pooled_lock);
+    struct wyt_pooled_t* pooled = wyt_pooled_idle;
+    if (pooled != NULL)
+    {
+        wyt_pooled_idle = pooled->next;
+        --wyt_pooled_parked;
+
+        pooled->task = task;
+        pooled->signal = 1;
+        wyt_wake_one(&pooled->signal);
+    }
+    wyt_lock_release(&wyt_pooled_lock);
+
+    if (pooled == NULL)
+    {
+        pooled = wyt_backend_alloc(sizeof(struct wyt_pooled_t));
+        if (pooled != NULL)
+        {
+            pooled->next = NULL;
+            pooled->task = task;
+            pooled->signal = 1;
+        }
+
+        wyt_thread_t const thread = (pooled != NULL) ? wyt_spawn(wyt_pooled_main, pooled) : NULL;
+        if (thread == NULL)
+        {
+            wyt_backend_free(pooled);
+            wyt_backend_free(task);
+            return NULL;
+        }
+
+        wyt_detach(thread);
+    }
+
+    return (wyt_thread_t)((uintptr_t)task | 1u);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_arena_t wyt_arena_create(size_t const chunk_size)
+{
+    const size_t page = wyt_backend_page_size();
+
+    size_t size = (chunk_size != 0) ? chunk_size : WYT_ARENA_CHUNK_DEFAULT;
+    if (size > SIZE_MAX - page) return NULL;
+    size = ((size + page - 1) / page) * page;
+
+    struct wyt_arena_chunk_t* const chunk = wyt_arena_map(size);
+    if (chunk == NULL) return NULL;
+
+    struct wyt_arena_impl_t* const self = (struct wyt_arena_impl_t*)(chunk + 1);
+    self->first = chunk;
+    self->current = chunk;
+    self->position = (unsigned char*)(self + 1);
+    self->limit = chunk->end;
+    self->chunk_size = size;
+    self->page = page;
+    return self;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_arena_destroy(wyt_arena_t const arena)
+{
+    struct wyt_arena_impl_t* const self = (struct wyt_arena_impl_t*)arena;
+    WYT_ASSUME(self != NULL);
+
+    // The arena lives in the first chunk, so each link is read before its chunk is unmapped.
+    struct wyt_arena_chunk_t* chunk = self->first;
+    while (chunk != NULL)
+    {
+        struct wyt_arena_chunk_t* const next = chunk->next;
+        wyt_backend_unmap(chunk, (size_t)(chunk->end - (unsigned char*)chunk));
+        chunk = next;
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void* wyt_arena_alloc(wyt_arena_t const arena, size_t const size, size_t const align)
+{
+    struct wyt_arena_impl_t* const self = (struct wyt_arena_impl_t*)arena;
+    WYT_ASSUME(self != NULL);
+    WYT_ASSUME((align != 0) && ((align & (align - 1)) == 0));
+
+    const uintptr_t aligned = ((uintptr_t)self->position + (align - 1)) & ~(uintptr_t)(align - 1);
+    const uintptr_t limit = (uintptr_t)self->limit;
+    if ((aligned > limit) || (size > limit - aligned)) return wyt_arena_grow(self, size, align);
+
+    self->position = (unsigned char*)aligned + size;
+    return (void*)aligned;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_arena_reset(wyt_arena_t const arena)
+{
+    struct wyt_arena_impl_t* const self = (struct wyt_arena_impl_t*)arena;
+    WYT_ASSUME(self != NULL);
+
+    self->current = self->first;
+    self->position = (unsigned char*)(self + 1);
+    self->limit = self->first->end;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_arena_mark_t wyt_arena_mark(wyt_arena_t const arena)
+{
+    const struct wyt_arena_impl_t* const self = (const struct wyt_arena_impl_t*)arena;
+    WYT_ASSUME(self != NULL);
+
+    const wyt_arena_mark_t mark = { .chunk = self->current, .position = self->position };
+    return mark;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_arena_rewind(wyt_arena_t const arena, wyt_arena_mark_t const mark)
+{
+    struct wyt_arena_impl_t* const self = (struct wyt_arena_impl_t*)arena;
+    WYT_ASSUME(self != NULL);
+    WYT_ASSUME(mark.chunk != NULL);
+
+    self->current = (struct wyt_arena_chunk_t*)mark.chunk;
+    self->position = (unsigned char*)mark.position;
+    self->limit = self->current->end;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_shring_t wyt_shring_open(const char* const name, size_t const capacity)
+{
+    _Static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "Shared atomics must be lock-free");
+    _Static_assert(ATOMIC_INT_LOCK_FREE == 2, "Shared atomics must be lock-free");
+
+    if ((capacity == 0) || (capacity > ((SIZE_MAX - WYT_SHRING_OFFSET) / 2u) + 1u)) return NULL;
+
+    size_t bytes = 1;
+    while (bytes < capacity) bytes *= 2u;
+
+    struct wyt_shring_impl_t* const self = wyt_backend_alloc(sizeof(struct wyt_shring_impl_t));
+    if (self == NULL) return NULL;
+
+    if (wyt_backend_shring_open(name, &self->readable, &self->writable))
+    {
+        self->shm = wyt_shm_open(name, WYT_SHRING_OFFSET + bytes);
+        if (self->shm != NULL)
+        {
+            self->header = (struct wyt_shring_header_t*)wyt_shm_data(self->shm);
+            self->data = (unsigned char*)self->header + WYT_SHRING_OFFSET;
+            self->mask = bytes - 1u;
+
+            // The first process to open the ring sets its capacity. Later processes must agree with it.
+            /// @see atomic_compare_exchange_strong_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_compare_exchange
+            unsigned long long expected = 0;
+            if (atomic_compare_exchange_strong_explicit(&self->header->capacity, &expected, (unsigned long long)bytes, memory_order_relaxed, memory_order_relaxed)
+                || (expected == (unsigned long long)bytes))
+            {
+                return (wyt_shring_t)self;
+            }
+
+            wyt_shm_close(self->shm);
+        }
+
+        wyt_backend_shring_close(self->readable, self->writable);
+    }
+
+    wyt_backend_free(self);
+    return NULL;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_shring_close(wyt_shring_t const ring)
+{
+    WYT_ASSUME(ring != NULL);
+    struct wyt_shring_impl_t* const self = (struct wyt_shring_impl_t*)ring;
+
+    wyt_shm_close(self->shm);
+    wyt_backend_shring_close(self->readable, self->writable);
+
+    wyt_backend_free(self);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern size_t wyt_shring_write_begin(wyt_shring_t const ring, void** const ptr)
+{
+    WYT_ASSUME((ring != NULL) && (ptr != NULL));
+    const struct wyt_shring_impl_t* const self = (const struct wyt_shring_impl_t*)ring;
+
+    /// @see atomic_load_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_load
+    const unsigned long long tail = atomic_load_explicit(&self->header->tail, memory_order_relaxed);
+    const size_t room = wyt_shring_available(self, true);
+
+    const size_t index = (size_t)tail & self->mask;
+    const size_t end = (self->mask + 1u) - index;
+
+    *ptr = self->data + index;
+    return (room < end) ? room : end;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_shring_write_end(wyt_shring_t const ring, size_t const bytes)
+{
+    WYT_ASSUME(ring != NULL);
+    const struct wyt_shring_impl_t* const self = (const struct wyt_shring_impl_t*)ring;
+    if (bytes == 0) return;
+
+    /// @see atomic_load_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_load
+    const unsigned long long tail = atomic_load_explicit(&self->header->tail, memory_order_relaxed);
+
+    /// @see atomic_store_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_store
+    atomic_store_explicit(&self->header->tail, tail + bytes, memory_order_release);
+    wyt_shring_notify(&self->header->readable, self->readable);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern size_t wyt_shring_read_begin(wyt_shring_t const ring, const void** const ptr)
+{
+    WYT_ASSUME((ring != NULL) && (ptr != NULL));
+    const struct wyt_shring_impl_t* const self = (const struct wyt_shring_impl_t*)ring;
+
+    /// @see atomic_load_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_load
+    const unsigned long long head = atomic_load_explicit(&self->header->head, memory_order_relaxed);
+    const size_t avail = wyt_shring_available(self, false);
+
+    const size_t index = (size_t)head & self->mask;
+    const size_t end = (self->mask + 1u) - index;
+
+    *ptr = self->data + index;
+    return (avail < end) ? avail : end;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_shring_read_end(wyt_shring_t const ring, size_t const bytes)
+{
+    WYT_ASSUME(ring != NULL);
+    const struct wyt_shring_impl_t* const self = (const struct wyt_shring_impl_t*)ring;
+    if (bytes == 0) return;
+
+    /// @see atomic_load_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_load
+    const unsigned long long head = atomic_load_explicit(&self->header->head, memory_order_relaxed);
+
+    /// @see atomic_store_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_store
+    atomic_store_explicit(&self->header->head, head + bytes, memory_order_release);
+    wyt_shring_notify(&self->header->writable, self->writable);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_bool_t wyt_shring_wait_write(wyt_shring_t const ring, size_t const bytes, wyt_utime_t const deadline)
+{
+    WYT_ASSUME(ring != NULL);
+    return wyt_shring_wait((const struct wyt_shring_impl_t*)ring, true, bytes, deadline);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_bool_t wyt_shring_wait_read(wyt_shring_t const ring, size_t const bytes, wyt_utime_t const deadline)
+{
+    WYT_ASSUME(ring != NULL);
+    return wyt_shring_wait((const struct wyt_shring_impl_t*)ring, false, bytes, deadline);
+}
+
+// ================================================================================================================================
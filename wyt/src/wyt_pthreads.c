@@ -8,70 +8,1281 @@
 #endif
 
 #include <wyt.h>
+#include "wyt_backend.h"
 
 #include <limits.h>
 #include <stddef.h>
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
 #include <errno.h>
 #include <time.h>
+#include <signal.h>
+#include <stdatomic.h>
 
 #include <sys/types.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <unistd.h>
+#include <poll.h>
+#include <fcntl.h>
 #include <pthread.h>
+#include <semaphore.h>
 #ifdef __APPLE__
     #include <dispatch/dispatch.h>
+    #include <pthread/qos.h>
+    #include <sys/sysctl.h>
+    #include <mach/mach_time.h>
 #else
     #include <sched.h>
-    #include <semaphore.h>
+    #include <dirent.h>
+    #include <sys/prctl.h>
+    #include <sys/timerfd.h>
+    #include <sys/eventfd.h>
+    #include <sys/syscall.h>
+    #include <linux/futex.h>
+    #if defined(__x86_64__) || defined(__i386__)
+        #include <x86intrin.h>
+        #include <cpuid.h>
+    #endif
+#endif
+
+#if (__STDC_VERSION__ <= 201710L)
+    #ifdef true
+        #undef true
+    #endif
+    #ifdef false
+        #undef false
+    #endif
+    #define true ((wyt_bool_t)1)
+    #define false ((wyt_bool_t)0)
+#endif
+
+// ================================================================================================================================
+//  Private Macros
+// --------------------------------------------------------------------------------------------------------------------------------
+
+/// @see abort | <stdlib.h> [libc] (POSIX.1) | https://en.cppreference.com/w/c/program/abort | https://man7.org/linux/man-pages/man3/abort.3.html | https://www.unix.com/man-page/mojave/3/abort/
+#define WYT_ASSERT(expr) if (expr) {} else abort()
+
+#ifdef NDEBUG
+    #define WYT_ASSUME(expr) ((void)0)
+#else
+    #define WYT_ASSUME(expr) WYT_ASSERT(expr)
+#endif
+
+#if defined(unreachable)
+    /// @see unreachable | (C23) | https://en.cppreference.com/w/c/program/unreachable 
+    #define WYT_UNREACHABLE() unreachable()
+#elif defined(__GNUC__) || defined(__clang__)
+    /// @see __builtin_unreachable | (GCC) | https://gcc.gnu.org/onlinedocs/gcc/Other-Builtins.html#index-_005f_005fbuiltin_005funreachable
+    /// @see __builtin_unreachable | (Clang) | https://clang.llvm.org/docs/LanguageExtensions.html#builtin-unreachable
+    #define WYT_UNREACHABLE() __builtin_unreachable()
+#elif defined(_MSC_VER)
+    /// @see __assume | (MSVC) | https://learn.microsoft.com/en-us/cpp/intrinsics/assume
+    #define WYT_UNREACHABLE() __assume(0)
+#else
+    #define WYT_UNREACHABLE() WYT_ASSERT(false)
+#endif
+
+// ================================================================================================================================
+//  Private Declarations
+// --------------------------------------------------------------------------------------------------------------------------------
+
+#ifdef __APPLE__
+    /// @see __ulock_wait | <sys/ulock.h> [libsystem_kernel] (macOS 10.12) | https://github.com/apple-oss-distributions/xnu/blob/main/bsd/sys/ulock.h
+    extern int __ulock_wait(uint32_t operation, void* addr, uint64_t value, uint32_t timeout);
+    /// @see __ulock_wake | <sys/ulock.h> [libsystem_kernel] (macOS 10.12) | https://github.com/apple-oss-distributions/xnu/blob/main/bsd/sys/ulock.h
+    extern int __ulock_wake(uint32_t operation, void* addr, uint64_t wake_value);
+
+    /// @see UL_COMPARE_AND_WAIT | <sys/ulock.h> (macOS 10.12)
+    #define WYT_UL_COMPARE_AND_WAIT 1
+    /// @see UL_COMPARE_AND_WAIT_SHARED | <sys/ulock.h> (macOS 10.12)
+    #define WYT_UL_COMPARE_AND_WAIT_SHARED 3
+    /// @see ULF_WAKE_ALL | <sys/ulock.h> (macOS 10.12)
+    #define WYT_ULF_WAKE_ALL 0x00000100
+#endif
+
+/**
+ * @brief Maximum length of a thread name, including the null-terminator.
+ */
+#ifdef __APPLE__
+    #define WYT_THREAD_NAME_MAX 64
+#else
+    #define WYT_THREAD_NAME_MAX 16
+#endif
+
+/**
+ * @brief Implementation of a periodic Ticker.
+ */
+struct wyt_ticker_impl_t
+{
+#ifndef __APPLE__
+    int fd;             ///< The timerfd that delivers the ticks.
+#endif
+    wyt_utime_t start;  ///< Timepoint the ticker was created at.
+    wyt_utime_t period; ///< Number of nanoseconds between ticks.
+    wyt_utime_t count;  ///< Number of ticks consumed so far.
+};
+
+/**
+ * @brief States of a thread switching to the scheduling policy in its `wyt_pthreads_start_t`.
+ */
+#define WYT_POLICY_PENDING 0u
+#define WYT_POLICY_APPLIED 1u
+#define WYT_POLICY_FAILED 2u
+
+/**
+ * @brief Start-up information for threads that must configure themselves before running the user's entry-function.
+ */
+struct wyt_pthreads_start_t
+{
+    wyt_entry_t func; ///< The user's entry-function.
+    void* arg; ///< The argument to pass to `func`.
+    char name[WYT_THREAD_NAME_MAX]; ///< The name to give the thread, or an empty string.
+    int policy; ///< The scheduling policy to switch to, or -1 to keep the configured policy.
+    _Atomic(wyt_word_t) status; ///< One of `WYT_POLICY_PENDING`, `WYT_POLICY_APPLIED`, or `WYT_POLICY_FAILED`. Only used if `policy` is set.
+    wyt_evsem_t exit_signal; ///< The Waitable Semaphore to release when the thread exits, or NULL.
+};
+
+/**
+ * @brief Entry-function for threads spawned with a `wyt_pthreads_start_t`.
+ * @param[in] ptr [non-null] Pointer to a heap-allocated `wyt_pthreads_start_t`.
+ *                Freed by this function, unless `policy` is set, in which case the spawner frees it once `status` is set.
+ */
+static void* wyt_pthreads_start(void* ptr);
+
+/**
+ * @brief Cleanup handler that releases the `exit_signal` of a thread.
+ * @param[in] ptr [non-null] The Waitable Semaphore to release.
+ */
+static void wyt_pthreads_exit_signal(void* ptr);
+
+/**
+ * @brief Copies a thread name into a fixed-size buffer, truncating it on a UTF-8 boundary if necessary.
+ * @param[out] dst [non-null] The buffer to copy into.
+ * @param[in]  src [non-null] The null-terminated name to copy.
+ */
+static void wyt_pthreads_copy_name(char dst[WYT_THREAD_NAME_MAX], const char* src);
+
+/**
+ * @brief Translates Wyt thread attributes into native thread attributes.
+ * @param[out] native [non-null] The initialized native attributes to modify.
+ * @param[out] start  [non-null] The start-up information for attributes that must be applied by the new thread itself.
+ * @param[in]  attr   [non-null] The Wyt attributes to translate.
+ * @return `true` if successful, `false` if any attribute could not be applied.
+ */
+static wyt_bool_t wyt_pthreads_apply_attr(pthread_attr_t* native, struct wyt_pthreads_start_t* start, const wyt_thread_attr_t* attr);
+
+#ifndef __APPLE__
+/**
+ * @brief Reads a small text file (such as those in sysfs/procfs) into a null-terminated buffer.
+ * @details Reads until the end of the file, or until `buf` is full, in which case the rest of the file is ignored.
+ * @param[in]  path [non-null] The path of the file to read.
+ * @param[out] buf  [non-null] The buffer to read into.
+ * @param len [positive] The size of `buf`.
+ * @return `true` if at least one byte was read, `false` otherwise.
+ */
+static wyt_bool_t wyt_pthreads_read_file(const char* path, char* buf, size_t len);
+
+/**
+ * @brief Reads a non-negative integer from the start of a small text file.
+ * @param[in] path [non-null] The path of the file to read.
+ * @return The integer, or -1 if the file could not be read or parsed.
+ */
+static long long wyt_pthreads_read_int(const char* path);
+
+/**
+ * @brief Queries the CPU bandwidth quota of the current process's cgroup.
+ * @return The number of CPUs worth of time the process may use, rounded up, or `UINT_MAX` if unlimited.
+ */
+static unsigned int wyt_pthreads_cgroup_quota(void);
+
+/**
+ * @brief Lowers a CPU bandwidth quota to the limits of a cgroup and all of its ancestors.
+ * @param[in,out] dir [non-null] The directory of the cgroup, which is truncated while walking up the hierarchy.
+ * @param root_len The length of the prefix of `dir` that is the directory of the root of the hierarchy.
+ * @param v1 `true` for a cgroup v1 hierarchy with the `cpu` controller, `false` for the cgroup v2 hierarchy.
+ * @param quota The quota so far, or `UINT_MAX` if unlimited.
+ * @return The lowered quota.
+ */
+static unsigned int wyt_pthreads_cgroup_walk(char* dir, size_t root_len, wyt_bool_t v1, unsigned int quota);
+
+/**
+ * @brief Reads a clock in nanoseconds.
+ * @param id The clock to read.
+ * @return The current timepoint of the clock.
+ */
+static wyt_utime_t wyt_pthreads_clock(clockid_t id);
+#endif
+
+#if !defined(__APPLE__) && (defined(__x86_64__) || defined(__i386__) || defined(__aarch64__))
+    #define WYT_PTHREADS_TSC
+
+#ifdef __SIZEOF_INT128__
+    __extension__ typedef unsigned __int128 wyt_pthreads_u128_t;
+#endif
+
+/**
+ * @brief Calibration of the CPU's timestamp counter against `CLOCK_MONOTONIC`.
+ */
+struct wyt_pthreads_tsc_t
+{
+    wyt_bool_t valid;       ///< Whether the counter is invariant and has been calibrated.
+    wyt_utime_t base_ticks; ///< Counter value at the calibration point.
+    wyt_utime_t base_nanos; ///< Timepoint of `CLOCK_MONOTONIC` at the calibration point.
+    wyt_utime_t ticks;      ///< Number of ticks elapsed during the calibration window.
+    wyt_utime_t nanos;      ///< Number of nanoseconds elapsed during the calibration window.
+    wyt_utime_t mult;       ///< Nanoseconds per tick, as a 32.32 fixed-point number.
+};
+
+/**
+ * @brief Calibration of the timestamp counter, shared by every thread.
+ */
+static struct wyt_pthreads_tsc_t wyt_pthreads_tsc;
+
+/**
+ * @brief Ensures `wyt_pthreads_tsc` is calibrated exactly once.
+ */
+static pthread_once_t wyt_pthreads_tsc_once = PTHREAD_ONCE_INIT;
+
+/**
+ * @brief Reads the CPU's timestamp counter.
+ */
+static wyt_utime_t wyt_pthreads_rdtsc(void);
+
+/**
+ * @brief Reads the timestamp counter and `CLOCK_MONOTONIC` as close together as possible.
+ * @param[out] ticks [non-null] The counter value.
+ * @param[out] nanos [non-null] The matching timepoint of `CLOCK_MONOTONIC`.
+ */
+static void wyt_pthreads_tsc_sample(wyt_utime_t* ticks, wyt_utime_t* nanos);
+
+/**
+ * @brief Detects whether the timestamp counter is invariant, and calibrates it if so.
+ * @details Called once, by the first caller of `wyt_nanotime_ex(wyt_clock_tsc)`. Blocks for about 10ms on x86.
+ */
+static void wyt_pthreads_tsc_calibrate(void);
+#endif
+
+/**
+ * @brief Maximum number of nanoseconds `wyt_join_until` waits on `CLOCK_REALTIME` at once.
+ */
+#define WYT_JOIN_SLICE 100000000uLL
+
+/**
+ * @brief Default size of a fiber's stack, in bytes.
+ */
+#define WYT_FIBER_STACK_DEFAULT ((size_t)256 * 1024)
+
+/**
+ * @brief Minimum size of a fiber's stack, in bytes.
+ */
+#define WYT_FIBER_STACK_MIN ((size_t)16 * 1024)
+
+/**
+ * @brief Maximum number of destroyed fibers whose stacks are kept for reuse.
+ */
+#define WYT_FIBER_POOL_MAX 64
+
+#if defined(__x86_64__) || defined(__aarch64__)
+    #define WYT_PTHREADS_FIBER_ASM
+#else
+    #include <ucontext.h>
+#endif
+
+/**
+ * @brief Implementation of a Fiber.
+ * @details Stored at the top of the fiber's own stack mapping. Threads use a thread-local instance without a mapping.
+ */
+struct wyt_fiber_impl_t
+{
+#ifdef WYT_PTHREADS_FIBER_ASM
+    void* sp;                         ///< The saved stack pointer, while the fiber is suspended.
+#else
+    ucontext_t context;               ///< The saved context, while the fiber is suspended.
+#endif
+    wyt_fiber_entry_t func;           ///< The user's entry-function.
+    void* arg;                        ///< The argument to pass to `func`.
+    struct wyt_fiber_impl_t* resumer; ///< The fiber that most recently switched to this one.
+    struct wyt_fiber_impl_t* next;    ///< The next fiber in the pool of reusable stacks.
+    void* base;                       ///< The start of the stack mapping, including the guard page, or NULL for threads.
+    size_t size;                      ///< The size of the stack mapping, in bytes.
+    wyt_bool_t done;                  ///< Whether `func` has returned.
+};
+
+/**
+ * @brief The fiber representing the current thread itself.
+ */
+/// @see _Thread_local | (C11) | https://en.cppreference.com/w/c/language/storage_duration
+static _Thread_local struct wyt_fiber_impl_t wyt_pthreads_fiber_root;
+
+/**
+ * @brief The fiber running on the current thread, or NULL if fibers have not been used yet.
+ */
+static _Thread_local struct wyt_fiber_impl_t* wyt_pthreads_fiber_self;
+
+/**
+ * @brief Protects `wyt_pthreads_fiber_pool` and `wyt_pthreads_fiber_pooled`.
+ */
+static pthread_mutex_t wyt_pthreads_fiber_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/**
+ * @brief Singly-linked list of finished fibers whose stacks can be reused.
+ */
+static struct wyt_fiber_impl_t* wyt_pthreads_fiber_pool;
+
+/**
+ * @brief The number of fibers in `wyt_pthreads_fiber_pool`, at most `WYT_FIBER_POOL_MAX`.
+ */
+static unsigned int wyt_pthreads_fiber_pooled;
+
+#ifdef WYT_PTHREADS_FIBER_ASM
+/**
+ * @brief Saves the callee-saved registers on the current stack, and restores those saved on another stack.
+ * @param[out] save [non-null] Receives the stack pointer of the suspended context.
+ * @param[in]  load [non-null] The stack pointer of the context to resume.
+ */
+extern void wyt_pthreads_jump(void** save, void* load) __asm__("wyt_pthreads_jump");
+#endif
+
+/**
+ * @brief Returns the implementation of the current fiber, lazily initializing the one representing the thread itself.
+ */
+static struct wyt_fiber_impl_t* wyt_pthreads_fiber_current(void);
+
+/**
+ * @brief Prepares a fiber's context, so that switching to it calls `wyt_pthreads_fiber_main`.
+ * @param[in,out] self [non-null] The fiber to prepare.
+ * @param[in] bottom [non-null] The lowest address of the usable stack.
+ * @param[in] top [non-null] The highest address of the usable stack, aligned to 16 bytes.
+ */
+static void wyt_pthreads_fiber_init(struct wyt_fiber_impl_t* self, unsigned char* bottom, unsigned char* top);
+
+/**
+ * @brief Entry-point of every fiber. Runs the user's entry-function, then switches back to the fiber's last resumer.
+ */
+static void wyt_pthreads_fiber_main(void);
+
+/**
+ * @brief The arena returned by `wyt_arena_local` on the current thread, or NULL if it has not been created yet.
+ */
+static _Thread_local wyt_arena_t wyt_pthreads_arena_local;
+
+/**
+ * @brief Thread-specific key whose destructor destroys the arenas returned by `wyt_arena_local`.
+ */
+static pthread_key_t wyt_pthreads_arena_key;
+
+/**
+ * @brief Ensures `wyt_pthreads_arena_key` is created exactly once.
+ */
+static pthread_once_t wyt_pthreads_arena_once = PTHREAD_ONCE_INIT;
+
+/**
+ * @brief The result of creating `wyt_pthreads_arena_key`. Non-zero if it could not be created.
+ */
+static int wyt_pthreads_arena_error;
+
+/**
+ * @brief Creates the thread-specific key whose destructor destroys the arenas returned by `wyt_arena_local`.
+ */
+static void wyt_pthreads_arena_init(void);
+
+/**
+ * @brief Thread-specific destructor of the arenas returned by `wyt_arena_local`.
+ * @param[in] ptr [non-null] The arena.
+ */
+static void wyt_pthreads_arena_exit(void* ptr);
+
+/**
+ * @brief Maximum number of Thread-Local Storage keys that can exist at the same time.
+ */
+#define WYT_TLS_SLOTS 128u
+
+/**
+ * @brief Implementation of a Thread-Local Storage key.
+ */
+struct wyt_tls_impl_t
+{
+    pthread_key_t key;               ///< The native key, which holds a pointer to the thread's entry while its value is non-NULL.
+    wyt_tls_destructor_t destructor; ///< The user's destructor, or NULL if the key has no native key.
+    unsigned long long id;           ///< The unique ID of the key.
+    unsigned int slot;               ///< The index of the key's entry in each thread.
+};
+
+/**
+ * @brief A thread's value of the Thread-Local Storage key using the same slot.
+ */
+struct wyt_tls_entry_t
+{
+    unsigned long long id; ///< The unique ID of the key the value belongs to. Stale IDs belong to destroyed keys.
+    void* value;           ///< The thread's value.
+};
+
+/**
+ * @brief The current thread's values, indexed by the slot of their key.
+ */
+static _Thread_local struct wyt_tls_entry_t wyt_pthreads_tls[WYT_TLS_SLOTS];
+
+/**
+ * @brief Protects `wyt_pthreads_tls_keys` and `wyt_pthreads_tls_ids`.
+ */
+static pthread_mutex_t wyt_pthreads_tls_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/**
+ * @brief The key using each slot, or NULL.
+ */
+static struct wyt_tls_impl_t* wyt_pthreads_tls_keys[WYT_TLS_SLOTS];
+
+/**
+ * @brief The last ID given to a key.
+ */
+static unsigned long long wyt_pthreads_tls_ids;
+
+/**
+ * @brief Thread-specific destructor of keys with a user destructor.
+ * @param[in] ptr [non-null] The exiting thread's entry, which is cleared before the user destructor is called.
+ */
+static void wyt_pthreads_tls_exit(void* ptr);
+
+/**
+ * @brief Implementation of a Waitable Semaphore.
+ * @details The counter is stored in the kernel object, so that it can be polled.
+ *          Linux uses a single eventfd in semaphore-mode. MacOS uses a pipe holding one byte per count.
+ */
+struct wyt_evsem_impl_t
+{
+    int read_fd;  ///< File Descriptor that is readable while the counter is non-zero.
+    int write_fd; ///< File Descriptor that increments the counter. The same as `read_fd` on Linux.
+};
+
+/**
+ * @brief Maximum number of Waitable Semaphores that can be waited on at once.
+ */
+#define WYT_WAIT_ANY_MAX 64u
+
+/**
+ * @brief Maximum length of the name of a named object, including the leading slash and null-terminator.
+ */
+#define WYT_NAME_MAX 256u
+
+/**
+ * @brief Maximum number of times `wyt_shm_open` yields while waiting for another process to size a new segment.
+ */
+#define WYT_SHM_SPIN 10000u
+
+/**
+ * @brief Implementation of a mapped Shared Memory segment.
+ */
+struct wyt_shm_impl_t
+{
+    void* data;  ///< The address the segment is mapped at.
+    size_t size; ///< The size of the segment in bytes.
+};
+
+/**
+ * @brief Blocks the current thread while the word at `address` holds the value `expected`.
+ * @param shared `true` if the word may be waited on by other processes, `false` if it is private to the current process.
+ * @see wyt_wait
+ */
+static wyt_bool_t wyt_pthreads_wait(const void* address, uint32_t expected, wyt_utime_t deadline, wyt_bool_t shared);
+
+/**
+ * @brief Wakes threads waiting on the word at `address`.
+ * @param all `true` to wake all waiting threads, `false` to wake one.
+ * @param shared `true` if the word may be waited on by other processes, `false` if it is private to the current process.
+ */
+static void wyt_pthreads_wake(const void* address, wyt_bool_t all, wyt_bool_t shared);
+
+/**
+ * @brief Converts a deadline into a timeout for `poll`, rounding partial milliseconds up so that waits do not end early.
+ * @details `poll` measures timeouts on a different clock, so expiry must only be reported after a wait with a timeout of 0.
+ * @param deadline The timepoint to stop waiting at, or `WYT_FOREVER`.
+ * @return -1 if `deadline` is `WYT_FOREVER`, 0 if it has passed, or the number of milliseconds until it otherwise.
+ */
+static int wyt_pthreads_timeout(wyt_utime_t deadline);
+
+/**
+ * @brief Converts the name of a named object into the form expected by `sem_open` and `shm_open`.
+ * @param[out] path [non-null] Receives the name with a leading slash.
+ * @return `true` if the name fits, `false` otherwise.
+ */
+static wyt_bool_t wyt_pthreads_name(char path[WYT_NAME_MAX], const char* name);
+
+// ================================================================================================================================
+//  Private Definitions
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static void* wyt_pthreads_start(void* const ptr)
+{
+    const struct wyt_pthreads_start_t start = *(struct wyt_pthreads_start_t*)ptr;
+
+#ifndef __APPLE__
+    if (start.policy != -1)
+    {
+        // `pthread_attr_setschedpolicy` only accepts the POSIX policies, so the Linux-specific ones are applied here.
+        const struct sched_param param = { .sched_priority = 0 };
+
+        /// @see pthread_setschedparam | <pthread.h> [libpthread] (POSIX.1) | https://man7.org/linux/man-pages/man3/pthread_setschedparam.3.html
+        const int res = pthread_setschedparam(pthread_self(), start.policy, &param);
+
+        // The spawner waits for the outcome before returning, and fails the spawn if the policy could not be applied.
+        _Atomic(wyt_word_t)* const status = &((struct wyt_pthreads_start_t*)ptr)->status;
+        /// @see atomic_store_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_store
+        atomic_store_explicit(status, (res == 0) ? WYT_POLICY_APPLIED : WYT_POLICY_FAILED, memory_order_release);
+        wyt_pthreads_wake((const void*)status, false, false);
+
+        if (res != 0) return NULL;
+    }
+    else
+#endif
+    {
+        /// @see free | <stdlib.h> [libc] (POSIX.1) | https://en.cppreference.com/w/c/memory/free | https://man7.org/linux/man-pages/man3/free.3.html
+        free(ptr);
+    }
+
+    if (start.name[0] != '\0')
+    {
+    #ifdef __APPLE__
+        // MacOS threads can only name themselves.
+        /// @see pthread_setname_np | <pthread.h> [libpthread] (macOS 10.6) | https://www.unix.com/man-page/mojave/3/pthread_setname_np/
+        const int res = pthread_setname_np(start.name);
+    #else
+        /// @see pthread_setname_np | <pthread.h> [libpthread] (Linux 2.6.33) | https://man7.org/linux/man-pages/man3/pthread_setname_np.3.html
+        const int res = pthread_setname_np(pthread_self(), start.name);
+    #endif
+        (void)(res == 0);
+    }
+
+    if (start.exit_signal == NULL) return start.func(start.arg);
+
+    // The cleanup handler also runs when the thread calls `wyt_exit` or is cancelled.
+    void* retval = NULL;
+
+    /// @see pthread_cleanup_push | <pthread.h> [libpthread] (POSIX.1) (macOS 10.4) | https://man7.org/linux/man-pages/man3/pthread_cleanup_push.3.html | https://www.unix.com/man-page/mojave/3/pthread_cleanup_push/
+    pthread_cleanup_push(wyt_pthreads_exit_signal, start.exit_signal);
+    retval = start.func(start.arg);
+    /// @see pthread_cleanup_pop | <pthread.h> [libpthread] (POSIX.1) (macOS 10.4) | https://man7.org/linux/man-pages/man3/pthread_cleanup_push.3.html | https://www.unix.com/man-page/mojave/3/pthread_cleanup_pop/
+    pthread_cleanup_pop(1);
+
+    return retval;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static void wyt_pthreads_exit_signal(void* const ptr)
+{
+    const wyt_bool_t res = wyt_evsem_release((wyt_evsem_t)ptr);
+    (void)res;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static void wyt_pthreads_copy_name(char dst[WYT_THREAD_NAME_MAX], const char* const src)
+{
+    size_t len = strlen(src);
+    if (len >= WYT_THREAD_NAME_MAX)
+    {
+        len = WYT_THREAD_NAME_MAX - 1;
+
+        // Do not cut a multi-byte character in half.
+        while ((len > 0) && (((unsigned char)src[len] & 0xC0u) == 0x80u)) --len;
+    }
+
+    memcpy(dst, src, len);
+    dst[len] = '\0';
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static wyt_bool_t wyt_pthreads_apply_attr(pthread_attr_t* const native, struct wyt_pthreads_start_t* const start, const wyt_thread_attr_t* const attr)
+{
+    start->name[0] = '\0';
+    start->policy = -1;
+    /// @see atomic_init | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_init
+    atomic_init(&start->status, WYT_POLICY_PENDING);
+    start->exit_signal = attr->exit_signal;
+
+    if (attr->name != NULL) wyt_pthreads_copy_name(start->name, attr->name);
+
+    if (attr->stack_size != 0)
+    {
+        /// @see sysconf | <unistd.h> [libc] (POSIX.1) | https://man7.org/linux/man-pages/man3/sysconf.3.html | https://www.unix.com/man-page/mojave/3/sysconf/
+        const long page = sysconf(_SC_PAGESIZE);
+        const size_t granularity = (page > 0) ? (size_t)page : 4096;
+
+        /// @see PTHREAD_STACK_MIN | <limits.h> (POSIX.1)
+        size_t stack_size = (attr->stack_size < (size_t)PTHREAD_STACK_MIN) ? (size_t)PTHREAD_STACK_MIN : attr->stack_size;
+        stack_size = (stack_size + granularity - 1) / granularity * granularity;
+
+        /// @see pthread_attr_setstacksize | <pthread.h> [libpthread] (POSIX.1) (macOS 10.4) | https://man7.org/linux/man-pages/man3/pthread_attr_setstacksize.3.html | https://www.unix.com/man-page/mojave/3/pthread_attr_setstacksize/
+        const int res = pthread_attr_setstacksize(native, stack_size);
+        if (res != 0) return false;
+    }
+
+#ifndef __APPLE__
+    if ((attr->affinity != NULL) && (attr->affinity_len != 0))
+    {
+        /// @see CPU_SET | <sched.h> [libc] (Linux 2.5.8) | https://man7.org/linux/man-pages/man3/CPU_SET.3.html
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        for (size_t cpu = 0; (cpu < CPU_SETSIZE) && (cpu / 64 < attr->affinity_len); ++cpu)
+        {
+            if ((attr->affinity[cpu / 64] >> (cpu % 64)) & 1uLL) CPU_SET(cpu, &cpus);
+        }
+
+        /// @see pthread_attr_setaffinity_np | <pthread.h> [libpthread] (Linux 2.6) | https://man7.org/linux/man-pages/man3/pthread_attr_setaffinity_np.3.html
+        const int res = pthread_attr_setaffinity_np(native, sizeof(cpus), &cpus);
+        if (res != 0) return false;
+    }
+#endif
+
+    if (attr->priority != wyt_priority_default)
+    {
+    #ifdef __APPLE__
+        qos_class_t qos;
+        switch (attr->priority)
+        {
+            case wyt_priority_idle:     qos = QOS_CLASS_BACKGROUND;       break;
+            case wyt_priority_low:      qos = QOS_CLASS_UTILITY;          break;
+            case wyt_priority_high:     qos = QOS_CLASS_USER_INITIATED;   break;
+            case wyt_priority_realtime: qos = QOS_CLASS_USER_INTERACTIVE; break;
+            default:                    qos = QOS_CLASS_DEFAULT;          break;
+        }
+
+        /// @see pthread_attr_set_qos_class_np | <pthread/qos.h> [libpthread] (macOS 10.10) | https://developer.apple.com/documentation/kernel/1639637-pthread_attr_set_qos_class_np
+        const int res = pthread_attr_set_qos_class_np(native, qos, 0);
+        if (res != 0) return false;
+    #else
+        int policy;
+        switch (attr->priority)
+        {
+            case wyt_priority_idle:     policy = SCHED_IDLE;  break;
+            case wyt_priority_low:      policy = SCHED_BATCH; break;
+            case wyt_priority_high:     policy = SCHED_RR;    break;
+            case wyt_priority_realtime: policy = SCHED_FIFO;  break;
+            default:                    policy = SCHED_OTHER; break;
+        }
+
+        if ((policy == SCHED_IDLE) || (policy == SCHED_BATCH))
+        {
+            start->policy = policy;
+            return true;
+        }
+
+        /// @see sched_get_priority_min | <sched.h> [libc] (POSIX.1) | https://man7.org/linux/man-pages/man2/sched_get_priority_min.2.html
+        const int prio_min = sched_get_priority_min(policy);
+        /// @see sched_get_priority_max | <sched.h> [libc] (POSIX.1) | https://man7.org/linux/man-pages/man2/sched_get_priority_max.2.html
+        const int prio_max = sched_get_priority_max(policy);
+        if ((prio_min == -1) || (prio_max == -1)) return false;
+
+        // Real-time threads sit in the middle of the range, leaving room above them for the system.
+        const struct sched_param param = {
+            .sched_priority = (policy == SCHED_FIFO) ? (prio_min + prio_max) / 2 : prio_min,
+        };
+
+        /// @see pthread_attr_setinheritsched | <pthread.h> [libpthread] (POSIX.1) | https://man7.org/linux/man-pages/man3/pthread_attr_setinheritsched.3.html
+        const int res_inherit = pthread_attr_setinheritsched(native, PTHREAD_EXPLICIT_SCHED);
+        /// @see pthread_attr_setschedpolicy | <pthread.h> [libpthread] (POSIX.1) | https://man7.org/linux/man-pages/man3/pthread_attr_setschedpolicy.3.html
+        const int res_policy = pthread_attr_setschedpolicy(native, policy);
+        /// @see pthread_attr_setschedparam | <pthread.h> [libpthread] (POSIX.1) | https://man7.org/linux/man-pages/man3/pthread_attr_setschedparam.3.html
+        const int res_param = pthread_attr_setschedparam(native, &param);
+        if ((res_inherit != 0) || (res_policy != 0) || (res_param != 0)) return false;
+    #endif
+    }
+
+    return true;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+#ifndef __APPLE__
+static wyt_bool_t wyt_pthreads_read_file(const char* const path, char* const buf, size_t const len)
+{
+    /// @see open | <fcntl.h> [libc] (POSIX.1) | https://man7.org/linux/man-pages/man2/open.2.html
+    const int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd == -1) return false;
+
+    // Files in procfs may be generated a line at a time, so a single read can return less than the whole file.
+    size_t total = 0;
+    while (total < len - 1)
+    {
+        /// @see read | <unistd.h> [libc] (POSIX.1) | https://man7.org/linux/man-pages/man2/read.2.html
+        const ssize_t res = read(fd, buf + total, len - 1 - total);
+        if ((res == -1) && (errno == EINTR)) continue;
+        if (res <= 0) break;
+        total += (size_t)res;
+    }
+
+    /// @see close | <unistd.h> [libc] (POSIX.1) | https://man7.org/linux/man-pages/man2/close.2.html
+    const int res_close = close(fd);
+    (void)(res_close == 0);
+
+    if (total == 0) return false;
+
+    buf[total] = '\0';
+    return true;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static long long wyt_pthreads_read_int(const char* const path)
+{
+    char buf[32];
+    if (!wyt_pthreads_read_file(path, buf, sizeof(buf))) return -1;
+
+    /// @see strtoll | <stdlib.h> [libc] (POSIX.1) | https://en.cppreference.com/w/c/string/byte/strtol | https://man7.org/linux/man-pages/man3/strtol.3.html
+    char* end;
+    const long long val = strtoll(buf, &end, 10);
+    return ((end != buf) && (val >= 0)) ? val : -1;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static unsigned int wyt_pthreads_cgroup_quota(void)
+{
+    unsigned int quota = UINT_MAX;
+
+    // Each line is formatted as "$ID:$CONTROLLERS:$PATH". The cgroup v2 hierarchy has ID 0 and no controllers.
+    /// @see cgroups | (Linux 2.6.24) | https://man7.org/linux/man-pages/man7/cgroups.7.html
+    // Systems with cgroup v1 controllers mounted list one line per hierarchy, so the file can outgrow a small buffer.
+    char groups[4096];
+    if (!wyt_pthreads_read_file("/proc/self/cgroup", groups, sizeof(groups))) return quota;
+
+    for (const char* line = groups; line != NULL; line = strchr(line, '\n'), line = (line != NULL) ? line + 1 : NULL)
+    {
+        const char* const controllers = strchr(line, ':');
+        const char* const path = (controllers != NULL) ? strchr(controllers + 1, ':') : NULL;
+        if ((path == NULL) || (path > line + strcspn(line, "\n"))) continue;
+
+        const int controllers_len = (int)(path - (controllers + 1));
+        // The root is "/", which is dropped so that the root's directory is not read twice.
+        int path_len = (int)strcspn(path + 1, "\n");
+        if (path_len == 1) path_len = 0;
+
+        // cgroup v1 hierarchies are assumed to be mounted at their usual place, named after their controllers (such as "cpu,cpuacct").
+        wyt_bool_t v1 = false;
+        if (controllers_len != 0)
+        {
+            for (const char* name = controllers + 1; name < path; name += strcspn(name, ",:") + 1)
+            {
+                if ((strncmp(name, "cpu", 3) == 0) && ((name[3] == ',') || (name[3] == ':'))) v1 = true;
+            }
+            if (!v1) continue;
+        }
+
+        char dir[512];
+        const int root_len = snprintf(dir, sizeof(dir), "/sys/fs/cgroup%s%.*s", v1 ? "/" : "", controllers_len, controllers + 1);
+        if ((root_len < 0) || ((size_t)root_len >= sizeof(dir))) continue;
+        const int dir_len = snprintf(dir + root_len, sizeof(dir) - (size_t)root_len, "%.*s", path_len, path + 1);
+        if ((dir_len < 0) || ((size_t)dir_len >= sizeof(dir) - (size_t)root_len)) continue;
+
+        quota = wyt_pthreads_cgroup_walk(dir, (size_t)root_len, v1, quota);
+    }
+
+    return quota;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static unsigned int wyt_pthreads_cgroup_walk(char* const dir, size_t const root_len, wyt_bool_t const v1, unsigned int quota)
+{
+    // Every ancestor's limit applies. Without a cgroup namespace, a container's own cgroup is often the root of its mount,
+    // in which case the leading directories of the path do not exist, and walking up eventually finds the root's limit.
+    for (;;)
+    {
+        char path[512 + 32];
+        unsigned long long limit = 0;
+        unsigned long long period = 0;
+
+        if (v1)
+        {
+            /// @see CFS Bandwidth Control | (Linux 3.2) | https://docs.kernel.org/scheduler/sched-bwc.html
+            (void)snprintf(path, sizeof(path), "%s/cpu.cfs_quota_us", dir);
+            const long long quota_us = wyt_pthreads_read_int(path);
+            (void)snprintf(path, sizeof(path), "%s/cpu.cfs_period_us", dir);
+            const long long period_us = wyt_pthreads_read_int(path);
+
+            if ((quota_us > 0) && (period_us > 0))
+            {
+                limit = (unsigned long long)quota_us;
+                period = (unsigned long long)period_us;
+            }
+        }
+        else
+        {
+            /// @see cgroup v2 | (Linux 4.5) | https://docs.kernel.org/admin-guide/cgroup-v2.html#cpu-interface-files
+            char max[64];
+            (void)snprintf(path, sizeof(path), "%s/cpu.max", dir);
+
+            // Formatted as "$MAX $PERIOD", where $MAX may be "max".
+            if (wyt_pthreads_read_file(path, max, sizeof(max)) && (strncmp(max, "max", 3) != 0))
+            {
+                char* end;
+                limit = strtoull(max, &end, 10);
+                period = strtoull(end, NULL, 10);
+            }
+        }
+
+        if ((limit != 0) && (period != 0))
+        {
+            const unsigned long long cpus = (limit + period - 1) / period;
+            if (cpus < quota) quota = (unsigned int)cpus;
+        }
+
+        char* const slash = strrchr(dir, '/');
+        if ((slash == NULL) || ((size_t)(slash - dir) < root_len)) break;
+        *slash = '\0';
+    }
+
+    return quota;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static wyt_utime_t wyt_pthreads_clock(clockid_t const id)
+{
+    /// @see clock_gettime | <time.h> [libc] (Linux 2.6) | https://man7.org/linux/man-pages/man3/clock_gettime.3.html
+    struct timespec tp;
+    const int res = clock_gettime(id, &tp);
+    WYT_ASSERT(res == 0);
+
+    return (wyt_utime_t)tp.tv_sec * 1000000000uLL + (wyt_utime_t)tp.tv_nsec;
+}
+#endif
+
+#ifdef WYT_PTHREADS_TSC
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static wyt_utime_t wyt_pthreads_rdtsc(void)
+{
+#if defined(__aarch64__)
+    /// @see CNTVCT_EL0 | (ARMv8-A) | https://developer.arm.com/documentation/ddi0601/latest/AArch64-Registers/CNTVCT-EL0--Counter-timer-Virtual-Count-Register
+    wyt_utime_t ticks;
+    __asm__ __volatile__("mrs %0, cntvct_el0" : "=r"(ticks));
+    return ticks;
+#else
+    /// @see __rdtsc | <x86intrin.h> (GCC) | https://gcc.gnu.org/onlinedocs/gcc/x86-Built-in-Functions.html
+    return (wyt_utime_t)__rdtsc();
+#endif
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static void wyt_pthreads_tsc_sample(wyt_utime_t* const ticks, wyt_utime_t* const nanos)
+{
+    // Keep the sample with the narrowest bracket, to minimize the error from preemption.
+    wyt_utime_t best = ~(wyt_utime_t)0;
+    for (int i = 0; i < 8; ++i)
+    {
+        const wyt_utime_t before = wyt_pthreads_clock(CLOCK_MONOTONIC);
+        const wyt_utime_t counter = wyt_pthreads_rdtsc();
+        const wyt_utime_t after = wyt_pthreads_clock(CLOCK_MONOTONIC);
+
+        if (after - before < best)
+        {
+            best = after - before;
+            *ticks = counter;
+            *nanos = before + (after - before) / 2;
+        }
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static void wyt_pthreads_tsc_calibrate(void)
+{
+    wyt_utime_t base_ticks, base_nanos;
+    wyt_utime_t ticks, nanos;
+
+#if defined(__aarch64__)
+    // The generic timer runs at a fixed, architecturally reported frequency.
+    /// @see CNTFRQ_EL0 | (ARMv8-A) | https://developer.arm.com/documentation/ddi0601/latest/AArch64-Registers/CNTFRQ-EL0--Counter-timer-Frequency-Register
+    wyt_utime_t freq;
+    __asm__ __volatile__("mrs %0, cntfrq_el0" : "=r"(freq));
+    if (freq == 0) return;
+
+    wyt_pthreads_tsc_sample(&base_ticks, &base_nanos);
+    ticks = freq;
+    nanos = 1000000000uLL;
+#else
+    // CPUID.80000007H:EDX[8] reports an invariant TSC, which ticks at a constant rate regardless of P/C-states.
+    /// @see __get_cpuid | <cpuid.h> (GCC) | https://github.com/gcc-mirror/gcc/blob/master/gcc/config/i386/cpuid.h
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(0x80000000u, &eax, &ebx, &ecx, &edx) || (eax < 0x80000007u)) return;
+    if (!__get_cpuid(0x80000007u, &eax, &ebx, &ecx, &edx) || !(edx & (1u << 8))) return;
+
+    wyt_utime_t start_ticks, start_nanos;
+    wyt_pthreads_tsc_sample(&start_ticks, &start_nanos);
+
+    struct timespec dur = { .tv_sec = 0, .tv_nsec = 10000000L };
+    /// @see nanosleep | <time.h> [libc] (POSIX.1) | https://man7.org/linux/man-pages/man2/nanosleep.2.html
+    while ((nanosleep(&dur, &dur) != 0) && (errno == EINTR)) {}
+
+    wyt_pthreads_tsc_sample(&base_ticks, &base_nanos);
+    ticks = base_ticks - start_ticks;
+    nanos = base_nanos - start_nanos;
+    if ((ticks == 0) || (nanos == 0) || (nanos >= (1uLL << 32))) return;
 #endif
 
-#if (__STDC_VERSION__ <= 201710L)
-    #ifdef true
-        #undef true
-    #endif
-    #ifdef false
-        #undef false
+    wyt_pthreads_tsc.base_ticks = base_ticks;
+    wyt_pthreads_tsc.base_nanos = base_nanos;
+    wyt_pthreads_tsc.ticks = ticks;
+    wyt_pthreads_tsc.nanos = nanos;
+    wyt_pthreads_tsc.mult = (nanos << 32) / ticks;
+    wyt_pthreads_tsc.valid = true;
+}
+#endif
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+#ifdef WYT_PTHREADS_FIBER_ASM
+    #ifdef __APPLE__
+        #define WYT_PTHREADS_ASM_FUNC(name) ".globl " name "\n.private_extern " name "\n.p2align 4\n" name ":\n"
+    #else
+        #define WYT_PTHREADS_ASM_FUNC(name) ".globl " name "\n.hidden " name "\n.type " name ", %function\n.p2align 4\n" name ":\n"
     #endif
-    #define true ((wyt_bool_t)1)
-    #define false ((wyt_bool_t)0)
+
+#if defined(__x86_64__)
+/// @see System V ABI (x86-64) | https://gitlab.com/x86-psABIs/x86-64-ABI
+// Frame (from the saved stack pointer): MXCSR, x87 control word, r15, r14, r13, r12, rbx, rbp, return address.
+__asm__(
+    ".text\n"
+    WYT_PTHREADS_ASM_FUNC("wyt_pthreads_jump")
+    "    pushq %rbp\n"
+    "    pushq %rbx\n"
+    "    pushq %r12\n"
+    "    pushq %r13\n"
+    "    pushq %r14\n"
+    "    pushq %r15\n"
+    "    subq $8, %rsp\n"
+    "    stmxcsr (%rsp)\n"
+    "    fnstcw 4(%rsp)\n"
+    "    movq %rsp, (%rdi)\n"
+    "    movq %rsi, %rsp\n"
+    "    ldmxcsr (%rsp)\n"
+    "    fldcw 4(%rsp)\n"
+    "    addq $8, %rsp\n"
+    "    popq %r15\n"
+    "    popq %r14\n"
+    "    popq %r13\n"
+    "    popq %r12\n"
+    "    popq %rbx\n"
+    "    popq %rbp\n"
+    "    ret\n"
+);
+#else
+/// @see Procedure Call Standard (AArch64) | https://github.com/ARM-software/abi-aa/blob/main/aapcs64/aapcs64.rst
+// Frame (from the saved stack pointer): x19-x28, x29 (frame pointer), x30 (link register), d8-d15.
+__asm__(
+    ".text\n"
+    WYT_PTHREADS_ASM_FUNC("wyt_pthreads_jump")
+    "    sub sp, sp, #160\n"
+    "    stp x19, x20, [sp, #0]\n"
+    "    stp x21, x22, [sp, #16]\n"
+    "    stp x23, x24, [sp, #32]\n"
+    "    stp x25, x26, [sp, #48]\n"
+    "    stp x27, x28, [sp, #64]\n"
+    "    stp x29, x30, [sp, #80]\n"
+    "    stp d8, d9, [sp, #96]\n"
+    "    stp d10, d11, [sp, #112]\n"
+    "    stp d12, d13, [sp, #128]\n"
+    "    stp d14, d15, [sp, #144]\n"
+    "    mov x2, sp\n"
+    "    str x2, [x0]\n"
+    "    mov sp, x1\n"
+    "    ldp x19, x20, [sp, #0]\n"
+    "    ldp x21, x22, [sp, #16]\n"
+    "    ldp x23, x24, [sp, #32]\n"
+    "    ldp x25, x26, [sp, #48]\n"
+    "    ldp x27, x28, [sp, #64]\n"
+    "    ldp x29, x30, [sp, #80]\n"
+    "    ldp d8, d9, [sp, #96]\n"
+    "    ldp d10, d11, [sp, #112]\n"
+    "    ldp d12, d13, [sp, #128]\n"
+    "    ldp d14, d15, [sp, #144]\n"
+    "    add sp, sp, #160\n"
+    "    ret\n"
+);
+#endif
 #endif
 
-// ================================================================================================================================
-//  Private Macros
 // --------------------------------------------------------------------------------------------------------------------------------
 
-/// @see abort | <stdlib.h> [libc] (POSIX.1) | https://en.cppreference.com/w/c/program/abort | https://man7.org/linux/man-pages/man3/abort.3.html | https://www.unix.com/man-page/mojave/3/abort/
-#define WYT_ASSERT(expr) if (expr) {} else abort()
+static struct wyt_fiber_impl_t* wyt_pthreads_fiber_current(void)
+{
+    struct wyt_fiber_impl_t* self = wyt_pthreads_fiber_self;
+    if (self == NULL)
+    {
+        self = &wyt_pthreads_fiber_root;
+        wyt_pthreads_fiber_self = self;
+    }
+    return self;
+}
 
-#ifdef NDEBUG
-    #define WYT_ASSUME(expr) ((void)0)
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static void wyt_pthreads_fiber_init(struct wyt_fiber_impl_t* const self, unsigned char* const bottom, unsigned char* const top)
+{
+    self->done = false;
+    self->resumer = NULL;
+
+#if defined(WYT_PTHREADS_FIBER_ASM) && defined(__x86_64__)
+    // `wyt_pthreads_jump` returns into `wyt_pthreads_fiber_main`, which must see the stack as if it had been called.
+    uintptr_t* sp = (uintptr_t*)top;
+    *--sp = 0;                                         // Return address of `wyt_pthreads_fiber_main`, which never returns.
+    *--sp = (uintptr_t)&wyt_pthreads_fiber_main;       // Return address of `wyt_pthreads_jump`.
+    for (int i = 0; i < 6; ++i) *--sp = 0;             // rbp, rbx, r12-r15.
+    *--sp = (uintptr_t)0x1F80u | ((uintptr_t)0x037Fu << 32); // Default MXCSR and x87 control word.
+    self->sp = sp;
+    (void)bottom;
+#elif defined(WYT_PTHREADS_FIBER_ASM) && defined(__aarch64__)
+    uintptr_t* const sp = (uintptr_t*)top - 20;
+    memset(sp, 0, 20 * sizeof(uintptr_t));
+    sp[11] = (uintptr_t)&wyt_pthreads_fiber_main;      // x30, the return address of `wyt_pthreads_jump`.
+    self->sp = sp;
+    (void)bottom;
 #else
-    #define WYT_ASSUME(expr) WYT_ASSERT(expr)
+    /// @see getcontext | <ucontext.h> [libc] (POSIX.1-2001) | https://man7.org/linux/man-pages/man3/getcontext.3.html
+    const int res = getcontext(&self->context);
+    WYT_ASSERT(res == 0);
+
+    self->context.uc_stack.ss_sp = bottom;
+    self->context.uc_stack.ss_size = (size_t)(top - bottom);
+    self->context.uc_link = NULL;
+
+    /// @see makecontext | <ucontext.h> [libc] (POSIX.1-2001) | https://man7.org/linux/man-pages/man3/makecontext.3.html
+    makecontext(&self->context, wyt_pthreads_fiber_main, 0);
 #endif
+}
 
-#if defined(unreachable)
-    /// @see unreachable | (C23) | https://en.cppreference.com/w/c/program/unreachable 
-    #define WYT_UNREACHABLE() unreachable()
-#elif defined(__GNUC__) || defined(__clang__)
-    /// @see __builtin_unreachable | (GCC) | https://gcc.gnu.org/onlinedocs/gcc/Other-Builtins.html#index-_005f_005fbuiltin_005funreachable
-    /// @see __builtin_unreachable | (Clang) | https://clang.llvm.org/docs/LanguageExtensions.html#builtin-unreachable
-    #define WYT_UNREACHABLE() __builtin_unreachable()
-#elif defined(_MSC_VER)
-    /// @see __assume | (MSVC) | https://learn.microsoft.com/en-us/cpp/intrinsics/assume
-    #define WYT_UNREACHABLE() __assume(0)
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static void wyt_pthreads_fiber_main(void)
+{
+    struct wyt_fiber_impl_t* const self = wyt_pthreads_fiber_current();
+    self->func(self->arg);
+    self->done = true;
+
+    struct wyt_fiber_impl_t* const next = self->resumer;
+    wyt_pthreads_fiber_self = next;
+
+#ifdef WYT_PTHREADS_FIBER_ASM
+    wyt_pthreads_jump(&self->sp, next->sp);
 #else
-    #define WYT_UNREACHABLE() WYT_ASSERT(false)
+    /// @see setcontext | <ucontext.h> [libc] (POSIX.1-2001) | https://man7.org/linux/man-pages/man3/setcontext.3.html
+    (void)setcontext(&next->context);
 #endif
+    WYT_UNREACHABLE();
+}
 
-// ================================================================================================================================
-//  Private Declarations
 // --------------------------------------------------------------------------------------------------------------------------------
 
-// ================================================================================================================================
-//  Private Definitions
+static void wyt_pthreads_arena_init(void)
+{
+    /// @see pthread_key_create | <pthread.h> [libpthread] (POSIX.1) | https://man7.org/linux/man-pages/man3/pthread_key_create.3p.html
+    wyt_pthreads_arena_error = pthread_key_create(&wyt_pthreads_arena_key, wyt_pthreads_arena_exit);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static void wyt_pthreads_arena_exit(void* const ptr)
+{
+    // Cleared first, so that later destructors calling `wyt_arena_local` create a new arena.
+    wyt_pthreads_arena_local = NULL;
+    wyt_arena_destroy((wyt_arena_t)ptr);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static void wyt_pthreads_tls_exit(void* const ptr)
+{
+    struct wyt_tls_entry_t* const entry = (struct wyt_tls_entry_t*)ptr;
+    const struct wyt_tls_impl_t* const self = wyt_pthreads_tls_keys[entry - wyt_pthreads_tls];
+    WYT_ASSUME((self != NULL) && (self->id == entry->id));
+
+    void* const value = entry->value;
+    entry->value = NULL;
+    self->destructor(value);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static wyt_bool_t wyt_pthreads_wait(const void* const address, uint32_t const expected, wyt_utime_t const deadline, wyt_bool_t const shared)
+{
+    wyt_utime_t duration = 0;
+    if (deadline != WYT_FOREVER)
+    {
+        const wyt_utime_t now = wyt_nanotime();
+        if (now >= deadline) return false;
+        duration = deadline - now;
+    }
+
+#ifdef __APPLE__
+    // A timeout of 0 waits indefinitely, so round partial microseconds up.
+    const wyt_utime_t micros = (duration + 999uLL) / 1000uLL;
+    const uint32_t timeout = (micros < UINT32_MAX) ? (uint32_t)micros : UINT32_MAX;
+
+    /// @see __ulock_wait | <sys/ulock.h> [libsystem_kernel] (macOS 10.12)
+    const uint32_t operation = shared ? WYT_UL_COMPARE_AND_WAIT_SHARED : WYT_UL_COMPARE_AND_WAIT;
+    const int res = __ulock_wait(operation, (void*)address, (uint64_t)expected, timeout);
+    if (res >= 0) return true;
+
+    WYT_ASSERT((errno == EINTR) || (errno == ETIMEDOUT));
+#else
+    const struct timespec rel = {
+        .tv_sec = (time_t)(duration / 1000000000uLL),
+        .tv_nsec = (long)(duration % 1000000000uLL),
+    };
+
+    /// @see futex | <linux/futex.h> <sys/syscall.h> [libc] (Linux 2.6.22) | https://man7.org/linux/man-pages/man2/futex.2.html
+    /// @see FUTEX_WAIT_PRIVATE | <linux/futex.h> (Linux 2.6.22)
+    const int operation = shared ? FUTEX_WAIT : FUTEX_WAIT_PRIVATE;
+    const long res = syscall(SYS_futex, address, operation, expected, (deadline != WYT_FOREVER) ? &rel : NULL, NULL, 0);
+    if (res == 0) return true;
+
+    WYT_ASSERT((errno == EAGAIN) || (errno == EINTR) || (errno == ETIMEDOUT));
+#endif
+    // Timeouts are measured on a different clock, so only report expiry once the deadline has actually passed.
+    return (deadline == WYT_FOREVER) || (wyt_nanotime() < deadline);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static void wyt_pthreads_wake(const void* const address, wyt_bool_t const all, wyt_bool_t const shared)
+{
+#ifdef __APPLE__
+    const uint32_t operation = (shared ? WYT_UL_COMPARE_AND_WAIT_SHARED : WYT_UL_COMPARE_AND_WAIT) | (all ? WYT_ULF_WAKE_ALL : 0);
+
+    /// @see __ulock_wake | <sys/ulock.h> [libsystem_kernel] (macOS 10.12)
+    const int res = __ulock_wake(operation, (void*)address, 0);
+    (void)(res != -1);
+#else
+    /// @see futex | <linux/futex.h> <sys/syscall.h> [libc] (Linux 2.6.22) | https://man7.org/linux/man-pages/man2/futex.2.html
+    /// @see FUTEX_WAKE_PRIVATE | <linux/futex.h> (Linux 2.6.22)
+    const int operation = shared ? FUTEX_WAKE : FUTEX_WAKE_PRIVATE;
+    const long res = syscall(SYS_futex, address, operation, all ? INT_MAX : 1, NULL, NULL, 0);
+
+    // The wake that releases a waiter often comes after the store that lets it return, so the waiter may have freed the word already.
+    // The kernel only faults if the memory was unmapped too. Waking the wrong threads is harmless, since waits may return spuriously.
+    WYT_ASSERT((res != -1) || (errno == EFAULT));
+#endif
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static int wyt_pthreads_timeout(wyt_utime_t const deadline)
+{
+    if (deadline == WYT_FOREVER) return -1;
+
+    const wyt_utime_t now = wyt_nanotime();
+    const wyt_utime_t millis = (now < deadline) ? (deadline - now + 999999uLL) / 1000000uLL : 0;
+    return (millis < (wyt_utime_t)INT_MAX) ? (int)millis : INT_MAX;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static wyt_bool_t wyt_pthreads_name(char path[WYT_NAME_MAX], const char* const name)
+{
+    WYT_ASSUME(name != NULL);
+
+    /// @see snprintf | <stdio.h> [libc] (C99) | https://en.cppreference.com/w/c/io/fprintf | https://man7.org/linux/man-pages/man3/snprintf.3.html
+    const int len = snprintf(path, WYT_NAME_MAX, "/%s", name);
+    return (len > 1) && ((unsigned int)len < WYT_NAME_MAX);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void* wyt_backend_alloc(size_t const size)
+{
+    /// @see malloc | <stdlib.h> [libc] (POSIX.1) | https://en.cppreference.com/w/c/memory/malloc | https://man7.org/linux/man-pages/man3/malloc.3.html
+    return malloc(size);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void* wyt_backend_realloc(void* const ptr, size_t const size)
+{
+    /// @see realloc | <stdlib.h> [libc] (POSIX.1) | https://en.cppreference.com/w/c/memory/realloc | https://man7.org/linux/man-pages/man3/realloc.3p.html
+    return realloc(ptr, size);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_backend_free(void* const ptr)
+{
+    /// @see free | <stdlib.h> [libc] (POSIX.1) | https://en.cppreference.com/w/c/memory/free | https://man7.org/linux/man-pages/man3/free.3.html
+    free(ptr);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern size_t wyt_backend_page_size(void)
+{
+    /// @see sysconf | <unistd.h> [libc] (POSIX.1) | https://man7.org/linux/man-pages/man3/sysconf.3.html
+    return (size_t)sysconf(_SC_PAGESIZE);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void* wyt_backend_map(size_t const size)
+{
+#ifdef __APPLE__
+    const int flags = MAP_PRIVATE | MAP_ANON;
+#else
+    const int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+#endif
+    /// @see mmap | <sys/mman.h> [libc] (POSIX.1) | https://man7.org/linux/man-pages/man2/mmap.2.html | https://www.unix.com/man-page/mojave/2/mmap/
+    void* const base = mmap(NULL, size, PROT_READ | PROT_WRITE, flags, -1, 0);
+    return (base != MAP_FAILED) ? base : NULL;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_backend_unmap(void* const ptr, size_t const size)
+{
+    /// @see munmap | <sys/mman.h> [libc] (POSIX.1) | https://man7.org/linux/man-pages/man2/munmap.2.html | https://www.unix.com/man-page/mojave/2/munmap/
+    const int res = munmap(ptr, size);
+    WYT_ASSERT(res == 0);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_bool_t wyt_backend_shring_open(const char* const name, void** const readable, void** const writable)
+{
+    // Futexes can be waited on across processes, so waiters sleep on the Event Count words themselves.
+    (void)name;
+    *readable = NULL;
+    *writable = NULL;
+    return true;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_backend_shring_close(void* const readable, void* const writable)
+{
+    (void)readable;
+    (void)writable;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_bool_t wyt_backend_shring_wait(void* const event, const void* const address, wyt_word_t const key, wyt_utime_t const deadline)
+{
+    (void)event;
+    return wyt_pthreads_wait(address, key, deadline, true);
+}
+
 // --------------------------------------------------------------------------------------------------------------------------------
 
+extern void wyt_backend_shring_wake(void* const event, const void* const address)
+{
+    (void)event;
+    wyt_pthreads_wake(address, true, true);
+}
+
 // ================================================================================================================================
 //  Public Definitions
 // --------------------------------------------------------------------------------------------------------------------------------
@@ -97,6 +1308,73 @@ extern wyt_utime_t wyt_nanotime(void)
 
 // --------------------------------------------------------------------------------------------------------------------------------
 
+extern wyt_utime_t wyt_nanotime_ex(wyt_clock_t const source)
+{
+#ifdef __APPLE__
+    clockid_t id;
+    switch (source)
+    {
+        case wyt_clock_monotonic: id = CLOCK_MONOTONIC; break;
+        case wyt_clock_monotonic_raw: id = CLOCK_MONOTONIC_RAW; break;
+        case wyt_clock_coarse: id = CLOCK_MONOTONIC_RAW_APPROX; break;
+        case wyt_clock_tsc:
+        {
+            /// @see mach_timebase_info | <mach/mach_time.h> [libsystem_kernel] (macOS 10.0) | https://developer.apple.com/documentation/driverkit/3433733-mach_timebase_info
+            mach_timebase_info_data_t info;
+            const kern_return_t res = mach_timebase_info(&info);
+            WYT_ASSERT(res == KERN_SUCCESS);
+
+            /// @see mach_absolute_time | <mach/mach_time.h> [libsystem_kernel] (macOS 10.0) | https://developer.apple.com/documentation/kernel/1462446-mach_absolute_time
+            const wyt_utime_t ticks = (wyt_utime_t)mach_absolute_time();
+            return (info.numer == info.denom) ? ticks : wyt_scale(ticks, info.numer, info.denom);
+        }
+        default: return wyt_nanotime();
+    }
+
+    /// @see clock_gettime_nsec_np | <time.h> [libc] (macOS 10.12) | https://www.unix.com/man-page/mojave/3/clock_gettime_nsec_np/
+    const uint64_t res = clock_gettime_nsec_np(id);
+    WYT_ASSERT(res != 0);
+
+    return (wyt_utime_t)res;
+#else
+    switch (source)
+    {
+        /// @see CLOCK_MONOTONIC | <time.h> (Linux 2.6) | https://man7.org/linux/man-pages/man3/clock_gettime.3.html
+        case wyt_clock_monotonic: return wyt_pthreads_clock(CLOCK_MONOTONIC);
+        /// @see CLOCK_MONOTONIC_RAW | <time.h> (Linux 2.6.28) | https://man7.org/linux/man-pages/man3/clock_gettime.3.html
+        case wyt_clock_monotonic_raw: return wyt_pthreads_clock(CLOCK_MONOTONIC_RAW);
+        /// @see CLOCK_MONOTONIC_COARSE | <time.h> (Linux 2.6.32) | https://man7.org/linux/man-pages/man3/clock_gettime.3.html
+        case wyt_clock_coarse: return wyt_pthreads_clock(CLOCK_MONOTONIC_COARSE);
+        case wyt_clock_tsc:
+        {
+        #ifdef WYT_PTHREADS_TSC
+            /// @see pthread_once | <pthread.h> [libpthread] (POSIX.1) | https://man7.org/linux/man-pages/man3/pthread_once.3p.html
+            const int res = pthread_once(&wyt_pthreads_tsc_once, wyt_pthreads_tsc_calibrate);
+            WYT_ASSERT(res == 0);
+
+            if (wyt_pthreads_tsc.valid)
+            {
+                // The counters of different cores may be slightly out of sync, so the counter can read behind the calibration point.
+                const wyt_utime_t ticks = wyt_pthreads_rdtsc();
+                const wyt_bool_t ahead = ticks >= wyt_pthreads_tsc.base_ticks;
+                const wyt_utime_t delta = ahead ? (ticks - wyt_pthreads_tsc.base_ticks) : (wyt_pthreads_tsc.base_ticks - ticks);
+            #ifdef __SIZEOF_INT128__
+                const wyt_utime_t elapsed = (wyt_utime_t)(((wyt_pthreads_u128_t)delta * wyt_pthreads_tsc.mult) >> 32);
+            #else
+                const wyt_utime_t elapsed = wyt_scale(delta, wyt_pthreads_tsc.nanos, wyt_pthreads_tsc.ticks);
+            #endif
+                return ahead ? (wyt_pthreads_tsc.base_nanos + elapsed) : (wyt_pthreads_tsc.base_nanos - elapsed);
+            }
+        #endif
+            return wyt_pthreads_clock(CLOCK_MONOTONIC);
+        }
+        default: return wyt_nanotime();
+    }
+#endif
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
 extern void wyt_nanosleep_for(wyt_stime_t const duration)
 {
     if (duration <= 0) return;
@@ -144,6 +1422,137 @@ extern void wyt_nanosleep_until(wyt_utime_t const timepoint)
 
 // --------------------------------------------------------------------------------------------------------------------------------
 
+extern wyt_utime_t wyt_timer_slack_get(void)
+{
+#ifdef __APPLE__
+    return 0;
+#else
+    /// @see prctl | <sys/prctl.h> [libc] (Linux 2.1.57) | https://man7.org/linux/man-pages/man2/prctl.2.html
+    /// @see PR_GET_TIMERSLACK | <sys/prctl.h> (Linux 2.6.28) | https://man7.org/linux/man-pages/man2/PR_GET_TIMERSLACK.2const.html
+    const int res = prctl(PR_GET_TIMERSLACK, 0, 0, 0, 0);
+    return (res > 0) ? (wyt_utime_t)res : 0;
+#endif
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_bool_t wyt_timer_slack_set(wyt_utime_t const slack)
+{
+#ifdef __APPLE__
+    (void)slack;
+    return false;
+#else
+    /// @see prctl | <sys/prctl.h> [libc] (Linux 2.1.57) | https://man7.org/linux/man-pages/man2/prctl.2.html
+    /// @see PR_SET_TIMERSLACK | <sys/prctl.h> (Linux 2.6.28) | https://man7.org/linux/man-pages/man2/PR_SET_TIMERSLACK.2const.html
+    const int res = prctl(PR_SET_TIMERSLACK, (unsigned long)slack, 0, 0, 0);
+    return res == 0;
+#endif
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_bool_t wyt_low_latency(wyt_bool_t const enable)
+{
+#ifdef __APPLE__
+    /// @see pthread_set_qos_class_self_np | <pthread/qos.h> [libpthread] (macOS 10.10) | https://developer.apple.com/documentation/kernel/1639638-pthread_set_qos_class_self_np
+    const int res = pthread_set_qos_class_self_np(enable ? QOS_CLASS_USER_INTERACTIVE : QOS_CLASS_DEFAULT, 0);
+    return res == 0;
+#else
+    // A slack of 0 restores the default, so 1ns is the smallest slack that can be requested.
+    return wyt_timer_slack_set(enable ? 1 : 0);
+#endif
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_ticker_t wyt_ticker_create(wyt_utime_t const period)
+{
+    if (period == 0) return NULL;
+
+    /// @see malloc | <stdlib.h> [libc] (POSIX.1) | https://en.cppreference.com/w/c/memory/malloc | https://man7.org/linux/man-pages/man3/malloc.3.html
+    struct wyt_ticker_impl_t* const self = malloc(sizeof(struct wyt_ticker_impl_t));
+    if (self == NULL) return NULL;
+
+    self->start = wyt_nanotime();
+    self->period = period;
+    self->count = 0;
+
+#ifndef __APPLE__
+    /// @see timerfd_create | <sys/timerfd.h> [libc] (Linux 2.6.25) | https://man7.org/linux/man-pages/man2/timerfd_create.2.html
+    self->fd = timerfd_create(CLOCK_BOOTTIME, TFD_CLOEXEC);
+    if (self->fd != -1)
+    {
+        const wyt_utime_t first = self->start + period;
+        const struct itimerspec spec = {
+            .it_interval = { .tv_sec = (time_t)(period / 1000000000uLL), .tv_nsec = (long)(period % 1000000000uLL) },
+            .it_value = { .tv_sec = (time_t)(first / 1000000000uLL), .tv_nsec = (long)(first % 1000000000uLL) },
+        };
+
+        /// @see timerfd_settime | <sys/timerfd.h> [libc] (Linux 2.6.25) | https://man7.org/linux/man-pages/man2/timerfd_settime.2.html
+        const int res = timerfd_settime(self->fd, TFD_TIMER_ABSTIME, &spec, NULL);
+        if (res == 0) return (wyt_ticker_t)self;
+
+        /// @see close | <unistd.h> [libc] (POSIX.1) | https://man7.org/linux/man-pages/man2/close.2.html
+        (void)close(self->fd);
+    }
+
+    /// @see free | <stdlib.h> [libc] (POSIX.1) | https://en.cppreference.com/w/c/memory/free | https://man7.org/linux/man-pages/man3/free.3.html
+    free(self);
+    return NULL;
+#else
+    return (wyt_ticker_t)self;
+#endif
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_ticker_destroy(wyt_ticker_t const ticker)
+{
+    WYT_ASSUME(ticker != NULL);
+    struct wyt_ticker_impl_t* const self = (struct wyt_ticker_impl_t*)ticker;
+
+#ifndef __APPLE__
+    /// @see close | <unistd.h> [libc] (POSIX.1) | https://man7.org/linux/man-pages/man2/close.2.html
+    const int res = close(self->fd);
+    WYT_ASSERT(res == 0);
+#endif
+
+    /// @see free | <stdlib.h> [libc] (POSIX.1) | https://en.cppreference.com/w/c/memory/free | https://man7.org/linux/man-pages/man3/free.3.html
+    free(self);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_utime_t wyt_ticker_wait(wyt_ticker_t const ticker, wyt_utime_t* const missed)
+{
+    WYT_ASSUME(ticker != NULL);
+    struct wyt_ticker_impl_t* const self = (struct wyt_ticker_impl_t*)ticker;
+
+#ifdef __APPLE__
+    wyt_nanosleep_until(self->start + (self->count + 1) * self->period);
+
+    const wyt_utime_t elapsed = (wyt_nanotime() - self->start) / self->period;
+    const wyt_utime_t expired = (elapsed > self->count) ? (elapsed - self->count) : 1;
+#else
+    uint64_t expired;
+    ssize_t res;
+    do {
+        // Blocks until the next expiration, then returns the number of expirations since the previous read.
+        /// @see read | <unistd.h> [libc] (POSIX.1) | https://man7.org/linux/man-pages/man2/read.2.html
+        res = read(self->fd, &expired, sizeof(expired));
+    } while ((res == -1) && (errno == EINTR));
+
+    WYT_ASSERT(res == (ssize_t)sizeof(expired));
+#endif
+
+    self->count += (wyt_utime_t)expired;
+    if (missed != NULL) *missed = (wyt_utime_t)expired - 1;
+
+    return self->start + self->count * self->period;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
 extern void wyt_yield(void)
 {
 #ifdef __APPLE__
@@ -158,16 +1567,84 @@ extern void wyt_yield(void)
 
 // --------------------------------------------------------------------------------------------------------------------------------
 
-extern wyt_thread_t wyt_spawn(wyt_entry_t const func, void* const arg)
+extern wyt_thread_t wyt_spawn(wyt_entry_t const func, void* const arg)
+{
+    return wyt_spawn_ex(func, arg, NULL);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_thread_t wyt_spawn_ex(wyt_entry_t const func, void* const arg, const wyt_thread_attr_t* const attr)
 {
-    /// @see pthread_create | <pthread.h> [libpthread] (POSIX.1) (macOS 10.4) | https://man7.org/linux/man-pages/man3/pthread_create.3.html | https://www.unix.com/man-page/mojave/3/pthread_create/
-    pthread_t thread;
-    const int res = pthread_create(&thread, NULL, func, arg);
-    if (res != 0) return NULL;
+    WYT_ASSUME(func != NULL);
 
     // Assumes `pthread_t` is an integer/pointer.
     _Static_assert(sizeof(pthread_t) <= sizeof(wyt_thread_t), "`pthread_t` too large");
 
+    if (attr == NULL)
+    {
+        /// @see pthread_create | <pthread.h> [libpthread] (POSIX.1) (macOS 10.4) | https://man7.org/linux/man-pages/man3/pthread_create.3.html | https://www.unix.com/man-page/mojave/3/pthread_create/
+        pthread_t thread;
+        const int res = pthread_create(&thread, NULL, func, arg);
+        if (res != 0) return NULL;
+
+        return (wyt_thread_t)thread;
+    }
+
+    /// @see pthread_attr_init | <pthread.h> [libpthread] (POSIX.1) (macOS 10.4) | https://man7.org/linux/man-pages/man3/pthread_attr_init.3.html | https://www.unix.com/man-page/mojave/3/pthread_attr_init/
+    pthread_attr_t native;
+    const int res_init = pthread_attr_init(&native);
+    if (res_init != 0) return NULL;
+
+    /// @see malloc | <stdlib.h> [libc] (POSIX.1) | https://en.cppreference.com/w/c/memory/malloc | https://man7.org/linux/man-pages/man3/malloc.3.html
+    struct wyt_pthreads_start_t* start = malloc(sizeof(struct wyt_pthreads_start_t));
+    int res_create = -1;
+    pthread_t thread;
+
+    if ((start != NULL) && wyt_pthreads_apply_attr(&native, start, attr))
+    {
+        start->func = func;
+        start->arg = arg;
+
+        // Threads only need a trampoline when they have to configure themselves, or signal their exit.
+        const wyt_bool_t trampoline = (start->name[0] != '\0') || (start->policy != -1) || (start->exit_signal != NULL);
+
+        /// @see pthread_create | <pthread.h> [libpthread] (POSIX.1) (macOS 10.4) | https://man7.org/linux/man-pages/man3/pthread_create.3.html | https://www.unix.com/man-page/mojave/3/pthread_create/
+        res_create = trampoline ? pthread_create(&thread, &native, wyt_pthreads_start, start) : pthread_create(&thread, &native, func, arg);
+
+        if ((res_create == 0) && (start->policy != -1))
+        {
+            // The thread returns without calling `func` if it could not switch policy, in which case the spawn fails.
+            /// @see atomic_load_explicit | <stdatomic.h> (C11) | https://en.cppreference.com/w/c/atomic/atomic_load
+            wyt_word_t status;
+            while ((status = atomic_load_explicit(&start->status, memory_order_acquire)) == WYT_POLICY_PENDING)
+            {
+                (void)wyt_pthreads_wait((const void*)&start->status, WYT_POLICY_PENDING, WYT_FOREVER, false);
+            }
+
+            if (status == WYT_POLICY_FAILED)
+            {
+                /// @see pthread_join | <pthread.h> [libpthread] (POSIX.1) (macOS 10.4) | https://man7.org/linux/man-pages/man3/pthread_join.3.html | https://www.unix.com/man-page/mojave/3/pthread_join/
+                const int res_join = pthread_join(thread, NULL);
+                WYT_ASSERT(res_join == 0);
+                res_create = -1;
+            }
+        }
+        else if ((res_create == 0) && trampoline)
+        {
+            start = NULL;
+        }
+    }
+
+    /// @see free | <stdlib.h> [libc] (POSIX.1) | https://en.cppreference.com/w/c/memory/free | https://man7.org/linux/man-pages/man3/free.3.html
+    free(start);
+
+    /// @see pthread_attr_destroy | <pthread.h> [libpthread] (POSIX.1) (macOS 10.4) | https://man7.org/linux/man-pages/man3/pthread_attr_destroy.3.html | https://www.unix.com/man-page/mojave/3/pthread_attr_destroy/
+    const int res_destroy = pthread_attr_destroy(&native);
+    WYT_ASSERT(res_destroy == 0);
+
+    if (res_create != 0) return NULL;
+
     return (wyt_thread_t)thread;
 }
 
@@ -175,6 +1652,9 @@ extern wyt_thread_t wyt_spawn(wyt_entry_t const func, void* const arg)
 
 WYT_NORETURN extern void wyt_exit(wyt_retval_t const retval)
 {
+    // Pooled threads report the value through their task.
+    wyt_pooled_exit(retval);
+
     /// @see pthread_exit | <pthread.h> [libpthread] (POSIX.1) (macOS 10.4) | https://man7.org/linux/man-pages/man3/pthread_exit.3.html | https://www.unix.com/man-page/mojave/3/pthread_exit/
     pthread_exit(retval);
     
@@ -185,17 +1665,90 @@ WYT_NORETURN extern void wyt_exit(wyt_retval_t const retval)
 
 extern wyt_retval_t wyt_join(wyt_thread_t const thread)
 {
-    /// @see pthread_join | <pthread.h> [libpthread] (POSIX.1) (macOS 10.4) | https://man7.org/linux/man-pages/man3/pthread_join.3.html | https://www.unix.com/man-page/mojave/3/pthread_join/
     wyt_retval_t retval;
-    const int res = pthread_join((pthread_t)thread, &retval);
-    WYT_ASSERT(res == 0);
+    const wyt_bool_t res = wyt_join_until(thread, WYT_FOREVER, &retval);
+    WYT_ASSERT(res);
     return retval;
 }
 
 // --------------------------------------------------------------------------------------------------------------------------------
 
+extern wyt_bool_t wyt_join_until(wyt_thread_t const thread, wyt_utime_t const deadline, wyt_retval_t* const retval)
+{
+    // Handles to pooled tasks are tagged, and joined through their task instead.
+    if (((uintptr_t)thread & 1u) != 0) return wyt_pooled_join(thread, deadline, retval);
+
+    const pthread_t native = (pthread_t)thread;
+    wyt_retval_t result;
+
+    if (deadline == WYT_FOREVER)
+    {
+        /// @see pthread_join | <pthread.h> [libpthread] (POSIX.1) (macOS 10.4) | https://man7.org/linux/man-pages/man3/pthread_join.3.html | https://www.unix.com/man-page/mojave/3/pthread_join/
+        const int res = pthread_join(native, &result);
+        WYT_ASSERT(res == 0);
+    }
+    else
+    {
+    #ifdef __APPLE__
+        // MacOS has no timed join. Threads stop accepting signals once they have terminated, so that is polled for instead.
+        for (;;)
+        {
+            /// @see pthread_kill | <signal.h> [libpthread] (POSIX.1) (macOS 10.4) | https://www.unix.com/man-page/mojave/2/pthread_kill/
+            if (pthread_kill(native, 0) == ESRCH) break;
+
+            const wyt_utime_t now = wyt_nanotime();
+            if (now >= deadline) return false;
+
+            const wyt_utime_t remaining = deadline - now;
+            wyt_nanosleep_for((wyt_stime_t)((remaining < 1000000uLL) ? remaining : 1000000uLL));
+        }
+
+        const int res = pthread_join(native, &result);
+        WYT_ASSERT(res == 0);
+    #else
+        for (;;)
+        {
+            const wyt_utime_t now = wyt_nanotime();
+            if (now >= deadline)
+            {
+                /// @see pthread_tryjoin_np | <pthread.h> [libpthread] (Linux 2.3.3) | https://man7.org/linux/man-pages/man3/pthread_tryjoin_np.3.html
+                const int res = pthread_tryjoin_np(native, &result);
+                if (res == EBUSY) return false;
+                WYT_ASSERT(res == 0);
+                break;
+            }
+
+            // Timed joins wait on `CLOCK_REALTIME`, so the wait is converted to a timepoint on it, in slices bounding the error of clock changes.
+            // Expiry is only decided by `wyt_nanotime`, which is checked again after every slice.
+            const wyt_utime_t remaining = deadline - now;
+            const wyt_utime_t target = wyt_pthreads_clock(CLOCK_REALTIME) + ((remaining < WYT_JOIN_SLICE) ? remaining : WYT_JOIN_SLICE);
+            const struct timespec abs = {
+                .tv_sec = (time_t)(target / 1000000000uLL),
+                .tv_nsec = (long)(target % 1000000000uLL),
+            };
+
+            /// @see pthread_timedjoin_np | <pthread.h> [libpthread] (Linux 2.3.3) | https://man7.org/linux/man-pages/man3/pthread_tryjoin_np.3.html
+            const int res = pthread_timedjoin_np(native, &result, &abs);
+            if (res == 0) break;
+            WYT_ASSERT(res == ETIMEDOUT);
+        }
+    #endif
+    }
+
+    if (retval != NULL) *retval = result;
+    return true;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
 extern void wyt_detach(wyt_thread_t const thread)
 {
+    if (((uintptr_t)thread & 1u) != 0)
+    {
+        wyt_pooled_detach(thread);
+        return;
+    }
+
     /// @see pthread_detach | <pthread.h> [libpthread] (POSIX.1) (macOS 10.4) | https://man7.org/linux/man-pages/man3/pthread_detach.3.html | https://www.unix.com/man-page/mojave/3/pthread_detach/
     const int res = pthread_detach((pthread_t)thread);
     WYT_ASSERT(res == 0);
@@ -259,6 +1812,16 @@ extern void wyt_sem_destroy(wyt_sem_t const sem)
 {
     WYT_ASSUME(sem != NULL);
 
+    if (((uintptr_t)sem & 1u) != 0)
+    {
+        sem_t* const named = (sem_t*)((uintptr_t)sem & ~(uintptr_t)1u);
+
+        /// @see sem_close | <semaphore.h> [libpthread] (POSIX.1) (macOS 10.4) | https://man7.org/linux/man-pages/man3/sem_close.3.html | https://www.unix.com/man-page/mojave/2/sem_close/
+        const int res_close = sem_close(named);
+        WYT_ASSERT(res_close == 0);
+        return;
+    }
+
 #ifdef __APPLE__
     const dispatch_semaphore_t obj = (dispatch_semaphore_t)sem;
 
@@ -283,20 +1846,23 @@ extern wyt_bool_t wyt_sem_release(wyt_sem_t const sem)
     WYT_ASSUME(sem != NULL);
 
 #if defined(__APPLE__)
-    const dispatch_semaphore_t obj = (dispatch_semaphore_t)sem;
+    if (((uintptr_t)sem & 1u) == 0)
+    {
+        const dispatch_semaphore_t obj = (dispatch_semaphore_t)sem;
 
-    /// @see dispatch_semaphore_signal | <dispatch/dispatch.h> [libdispatch] (macOS 10.6) | https://developer.apple.com/documentation/dispatch/1452919-dispatch_semaphore_signal
-    const intptr_t res = dispatch_semaphore_signal(obj);
-    (void)(res != 0);
+        /// @see dispatch_semaphore_signal | <dispatch/dispatch.h> [libdispatch] (macOS 10.6) | https://developer.apple.com/documentation/dispatch/1452919-dispatch_semaphore_signal
+        const intptr_t res = dispatch_semaphore_signal(obj);
+        (void)(res != 0);
 
-    return true; // Assume success (did not overflow)
-#else
-    sem_t* const ptr = (sem_t*)sem;
+        return true; // Assume success (did not overflow)
+    }
+#endif
+    // Named semaphores are tagged with the lowest bit.
+    sem_t* const ptr = (sem_t*)((uintptr_t)sem & ~(uintptr_t)1u);
 
     /// @see sem_post | <semaphore.h> [libpthread] (POSIX.1) | https://man7.org/linux/man-pages/man3/sem_post.3.html
     const int res = sem_post(ptr);
     return res == 0;
-#endif
 }
 
 // --------------------------------------------------------------------------------------------------------------------------------
@@ -306,13 +1872,17 @@ extern void wyt_sem_acquire(wyt_sem_t const sem)
     WYT_ASSUME(sem != NULL);
 
 #if defined(__APPLE__)
-    const dispatch_semaphore_t obj = (dispatch_semaphore_t)sem;
-
-    /// @see dispatch_semaphore_wait | <dispatch/dispatch.h> [libdispatch] (macOS 10.6) | https://developer.apple.com/documentation/dispatch/1453087-dispatch_semaphore_wait
-    const intptr_t res = dispatch_semaphore_wait(obj, DISPATCH_TIME_FOREVER);
-    WYT_ASSERT(res == 0);
-#else
-    sem_t* const ptr = (sem_t*)sem;
+    if (((uintptr_t)sem & 1u) == 0)
+    {
+        const dispatch_semaphore_t obj = (dispatch_semaphore_t)sem;
+
+        /// @see dispatch_semaphore_wait | <dispatch/dispatch.h> [libdispatch] (macOS 10.6) | https://developer.apple.com/documentation/dispatch/1453087-dispatch_semaphore_wait
+        const intptr_t res = dispatch_semaphore_wait(obj, DISPATCH_TIME_FOREVER);
+        WYT_ASSERT(res == 0);
+        return;
+    }
+#endif
+    sem_t* const ptr = (sem_t*)((uintptr_t)sem & ~(uintptr_t)1u);
 
     int res;
     do {
@@ -321,7 +1891,6 @@ extern void wyt_sem_acquire(wyt_sem_t const sem)
     } while ((res != 0) && (errno == EINTR));
 
     WYT_ASSERT(res == 0);
-#endif
 }
 
 // --------------------------------------------------------------------------------------------------------------------------------
@@ -331,13 +1900,16 @@ extern wyt_bool_t wyt_sem_try_acquire(wyt_sem_t const sem)
     WYT_ASSUME(sem != NULL);
 
 #if defined(__APPLE__)
-    const dispatch_semaphore_t obj = (dispatch_semaphore_t)sem;
-
-    /// @see dispatch_semaphore_wait | <dispatch/dispatch.h> [libdispatch] (macOS 10.6) | https://developer.apple.com/documentation/dispatch/1453087-dispatch_semaphore_wait
-    const intptr_t res = dispatch_semaphore_wait(obj, DISPATCH_TIME_NOW);
-    return res == 0;
-#else
-    sem_t* const ptr = (sem_t*)sem;
+    if (((uintptr_t)sem & 1u) == 0)
+    {
+        const dispatch_semaphore_t obj = (dispatch_semaphore_t)sem;
+
+        /// @see dispatch_semaphore_wait | <dispatch/dispatch.h> [libdispatch] (macOS 10.6) | https://developer.apple.com/documentation/dispatch/1453087-dispatch_semaphore_wait
+        const intptr_t res = dispatch_semaphore_wait(obj, DISPATCH_TIME_NOW);
+        return res == 0;
+    }
+#endif
+    sem_t* const ptr = (sem_t*)((uintptr_t)sem & ~(uintptr_t)1u);
 
     int res;
     do {
@@ -349,7 +1921,801 @@ extern wyt_bool_t wyt_sem_try_acquire(wyt_sem_t const sem)
     
     WYT_ASSERT(errno == EAGAIN);
     return false;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_bool_t wyt_wait(const wyt_word_t* const address, wyt_word_t const expected, wyt_utime_t const deadline)
+{
+    WYT_ASSUME(address != NULL);
+    _Static_assert(sizeof(wyt_word_t) == sizeof(uint32_t), "`wyt_word_t` must be 32 bits");
+
+    return wyt_pthreads_wait(address, expected, deadline, false);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_wake_one(const wyt_word_t* const address)
+{
+    WYT_ASSUME(address != NULL);
+    wyt_pthreads_wake(address, false, false);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_wake_all(const wyt_word_t* const address)
+{
+    WYT_ASSUME(address != NULL);
+    wyt_pthreads_wake(address, true, false);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_topology_t* wyt_topology_query(void)
+{
+#ifdef __APPLE__
+    /// @see sysctlbyname | <sys/sysctl.h> [libc] (macOS 10.0) | https://www.unix.com/man-page/mojave/3/sysctlbyname/
+    int logical = 0, physical = 0, packages = 0;
+    size_t len_logical = sizeof(logical), len_physical = sizeof(physical), len_packages = sizeof(packages);
+    if ((sysctlbyname("hw.logicalcpu", &logical, &len_logical, NULL, 0) != 0) || (logical <= 0)) return NULL;
+    if ((sysctlbyname("hw.physicalcpu", &physical, &len_physical, NULL, 0) != 0) || (physical <= 0)) physical = logical;
+    if ((sysctlbyname("hw.packages", &packages, &len_packages, NULL, 0) != 0) || (packages <= 0)) packages = 1;
+
+    // Number of CPUs sharing each level of the memory hierarchy. (Index 0 is main memory)
+    uint64_t config[4] = {0};
+    size_t len_config = sizeof(config);
+    (void)sysctlbyname("hw.cacheconfig", config, &len_config, NULL, 0);
+
+    int64_t l1d = 0, l2 = 0, l3 = 0;
+    size_t len_l1d = sizeof(l1d), len_l2 = sizeof(l2), len_l3 = sizeof(l3);
+    (void)sysctlbyname("hw.l1dcachesize", &l1d, &len_l1d, NULL, 0);
+    (void)sysctlbyname("hw.l2cachesize", &l2, &len_l2, NULL, 0);
+    (void)sysctlbyname("hw.l3cachesize", &l3, &len_l3, NULL, 0);
+
+    const unsigned int count = (unsigned int)logical;
+    const unsigned int per_core = (count + (unsigned int)physical - 1) / (unsigned int)physical;
+    const unsigned int per_package = (count + (unsigned int)packages - 1) / (unsigned int)packages;
+    const unsigned int per_l2 = ((l2 > 0) && (config[2] != 0)) ? (unsigned int)config[2] : per_core;
+    const unsigned int per_l3 = ((l3 > 0) && (config[3] != 0)) ? (unsigned int)config[3] : per_package;
+
+    /// @see malloc | <stdlib.h> [libc] (POSIX.1) | https://en.cppreference.com/w/c/memory/malloc | https://www.unix.com/man-page/mojave/3/malloc/
+    wyt_topology_t* const self = malloc(sizeof(wyt_topology_t) + count * sizeof(wyt_cpu_t));
+    if (self == NULL) return NULL;
+
+    wyt_cpu_t* const cpus = (wyt_cpu_t*)(self + 1);
+    for (unsigned int i = 0; i < count; ++i)
+    {
+        cpus[i] = (wyt_cpu_t){
+            .id = i,
+            .core = i / per_core,
+            .package = i / per_package,
+            .node = 0,
+            .l2 = i / per_l2,
+            .l3 = i / per_l3,
+        };
+    }
+
+    *self = (wyt_topology_t){
+        .cpu_count = count,
+        .core_count = (count + per_core - 1) / per_core,
+        .package_count = (count + per_package - 1) / per_package,
+        .node_count = 1,
+        .l2_count = (count + per_l2 - 1) / per_l2,
+        .l3_count = (count + per_l3 - 1) / per_l3,
+        .quota = count,
+        .l1d_size = (l1d > 0) ? (size_t)l1d : 0,
+        .l2_size = (l2 > 0) ? (size_t)l2 : 0,
+        .l3_size = (l3 > 0) ? (size_t)l3 : 0,
+        .cpus = cpus,
+    };
+    return self;
+#else
+    /// @see sched_getaffinity | <sched.h> [libc] (Linux 2.5.8) | https://man7.org/linux/man-pages/man2/sched_getaffinity.2.html
+    cpu_set_t allowed;
+    const int res_affinity = sched_getaffinity(0, sizeof(allowed), &allowed);
+    if (res_affinity != 0) return NULL;
+
+    /// @see CPU_COUNT | <sched.h> [libc] (Linux 2.5.8) | https://man7.org/linux/man-pages/man3/CPU_COUNT.3.html
+    const unsigned int count = (unsigned int)CPU_COUNT(&allowed);
+    if (count == 0) return NULL;
+
+    enum { key_core, key_package, key_node, key_l2, key_l3, key_len };
+
+    /// @see malloc | <stdlib.h> [libc] (POSIX.1) | https://en.cppreference.com/w/c/memory/malloc | https://man7.org/linux/man-pages/man3/malloc.3.html
+    wyt_topology_t* const self = malloc(sizeof(wyt_topology_t) + count * sizeof(wyt_cpu_t));
+    unsigned long long* const keys = malloc(key_len * count * sizeof(unsigned long long));
+    unsigned int* const indices = malloc(count * sizeof(unsigned int));
+
+    if ((self == NULL) || (keys == NULL) || (indices == NULL))
+    {
+        /// @see free | <stdlib.h> [libc] (POSIX.1) | https://en.cppreference.com/w/c/memory/free | https://man7.org/linux/man-pages/man3/free.3.html
+        free(self);
+        free(keys);
+        free(indices);
+        return NULL;
+    }
+
+    wyt_cpu_t* const cpus = (wyt_cpu_t*)(self + 1);
+    *self = (wyt_topology_t){ .cpus = cpus };
+
+    // Raw identifiers from sysfs are collected as keys first, then mapped to dense indices.
+    // Explicit cache keys are tagged so that they never collide with the fallback (core/package) keys.
+    static const unsigned long long cache_tag = 1uLL << 62;
+
+    unsigned int n = 0;
+    for (unsigned int cpu = 0; (cpu < CPU_SETSIZE) && (n < count); ++cpu)
+    {
+        /// @see CPU_ISSET | <sched.h> [libc] (Linux 2.5.8) | https://man7.org/linux/man-pages/man3/CPU_ISSET.3.html
+        if (!CPU_ISSET(cpu, &allowed)) continue;
+
+        /// @see sysfs-devices-system-cpu | (Linux 2.6) | https://docs.kernel.org/admin-guide/abi-stable.html#abi-sys-devices-system-cpu-cpux-topology-core-id
+        char path[128];
+        (void)snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/topology/physical_package_id", cpu);
+        const long long package = wyt_pthreads_read_int(path);
+        (void)snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/topology/core_id", cpu);
+        const long long core = wyt_pthreads_read_int(path);
+
+        #define WYT_KEY(kind) keys[(kind) * count + n]
+        WYT_KEY(key_package) = (package >= 0) ? (unsigned long long)package : 0;
+        WYT_KEY(key_core) = (core >= 0) ? ((WYT_KEY(key_package) << 32) | (unsigned long long)core) : ((cache_tag << 1) | cpu);
+        WYT_KEY(key_node) = 0;
+        WYT_KEY(key_l2) = WYT_KEY(key_core);
+        WYT_KEY(key_l3) = WYT_KEY(key_package);
+
+        // CPUs are linked to their NUMA node by a "nodeN" entry in their directory.
+        (void)snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u", cpu);
+        /// @see opendir | <dirent.h> [libc] (POSIX.1) | https://man7.org/linux/man-pages/man3/opendir.3.html
+        DIR* const dir = opendir(path);
+        if (dir != NULL)
+        {
+            /// @see readdir | <dirent.h> [libc] (POSIX.1) | https://man7.org/linux/man-pages/man3/readdir.3.html
+            for (const struct dirent* entry; (entry = readdir(dir)) != NULL; )
+            {
+                unsigned int node;
+                char tail;
+                /// @see sscanf | <stdio.h> [libc] (POSIX.1) | https://en.cppreference.com/w/c/io/fscanf | https://man7.org/linux/man-pages/man3/sscanf.3.html
+                if (sscanf(entry->d_name, "node%u%c", &node, &tail) == 1) { WYT_KEY(key_node) = node; break; }
+            }
+
+            /// @see closedir | <dirent.h> [libc] (POSIX.1) | https://man7.org/linux/man-pages/man3/closedir.3.html
+            const int res_close = closedir(dir);
+            (void)(res_close == 0);
+        }
+
+        /// @see sysfs-devices-system-cpu | (Linux 2.6.20) | https://docs.kernel.org/admin-guide/abi-stable.html#abi-sys-devices-system-cpu-cpux-cache-index3-cache-disable-x
+        for (unsigned int index = 0; index < 16; ++index)
+        {
+            (void)snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/cache/index%u/level", cpu, index);
+            const long long level = wyt_pthreads_read_int(path);
+            if (level < 0) break;
+
+            char buf[64];
+            (void)snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/cache/index%u/type", cpu, index);
+            if (!wyt_pthreads_read_file(path, buf, sizeof(buf)) || (strncmp(buf, "Instruction", 11) == 0)) continue;
+
+            // Formatted as a number with a unit suffix, e.g. "48K".
+            (void)snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/cache/index%u/size", cpu, index);
+            size_t size = 0;
+            if (wyt_pthreads_read_file(path, buf, sizeof(buf)))
+            {
+                char* end;
+                size = (size_t)strtoull(buf, &end, 10);
+                if (*end == 'K') size <<= 10;
+                if (*end == 'M') size <<= 20;
+            }
+
+            // The lowest CPU sharing the cache identifies it, e.g. "0-1,8-9".
+            (void)snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/cache/index%u/shared_cpu_list", cpu, index);
+            const long long first = wyt_pthreads_read_int(path);
+            const unsigned long long cache = cache_tag | (unsigned long long)((first >= 0) ? first : cpu);
+
+            if (level == 1) { if (n == 0) self->l1d_size = size; }
+            if (level == 2) { if (n == 0) self->l2_size = size; WYT_KEY(key_l2) = cache; }
+            if (level == 3) { if (n == 0) self->l3_size = size; WYT_KEY(key_l3) = cache; }
+        }
+        #undef WYT_KEY
+
+        cpus[n].id = cpu;
+        ++n;
+    }
+
+    self->cpu_count = n;
+
+    self->core_count = wyt_densify(&keys[key_core * count], indices, n);
+    for (unsigned int i = 0; i < n; ++i) cpus[i].core = indices[i];
+
+    self->package_count = wyt_densify(&keys[key_package * count], indices, n);
+    for (unsigned int i = 0; i < n; ++i) cpus[i].package = indices[i];
+
+    self->node_count = wyt_densify(&keys[key_node * count], indices, n);
+    for (unsigned int i = 0; i < n; ++i) cpus[i].node = indices[i];
+
+    self->l2_count = wyt_densify(&keys[key_l2 * count], indices, n);
+    for (unsigned int i = 0; i < n; ++i) cpus[i].l2 = indices[i];
+
+    self->l3_count = wyt_densify(&keys[key_l3 * count], indices, n);
+    for (unsigned int i = 0; i < n; ++i) cpus[i].l3 = indices[i];
+
+    const unsigned int quota = wyt_pthreads_cgroup_quota();
+    self->quota = (quota < n) ? quota : n;
+
+    free(keys);
+    free(indices);
+    return self;
+#endif
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_topology_free(wyt_topology_t* const topology)
+{
+    WYT_ASSUME(topology != NULL);
+
+    /// @see free | <stdlib.h> [libc] (POSIX.1) | https://en.cppreference.com/w/c/memory/free | https://man7.org/linux/man-pages/man3/free.3.html
+    free(topology);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_fiber_t wyt_fiber_create(wyt_fiber_entry_t const func, void* const arg, size_t const stack_size)
+{
+    WYT_ASSUME(func != NULL);
+
+    /// @see sysconf | <unistd.h> [libc] (POSIX.1) | https://man7.org/linux/man-pages/man3/sysconf.3.html
+    const size_t page = (size_t)sysconf(_SC_PAGESIZE);
+
+    size_t size = (stack_size != 0) ? stack_size : WYT_FIBER_STACK_DEFAULT;
+    if (size < WYT_FIBER_STACK_MIN) size = WYT_FIBER_STACK_MIN;
+    if (size > SIZE_MAX - 2 * page) return NULL;
+    size = ((size + page - 1) / page) * page + page;
+
+    struct wyt_fiber_impl_t* self = NULL;
+
+    /// @see pthread_mutex_lock | <pthread.h> [libpthread] (POSIX.1) | https://man7.org/linux/man-pages/man3/pthread_mutex_lock.3p.html
+    (void)pthread_mutex_lock(&wyt_pthreads_fiber_lock);
+    for (struct wyt_fiber_impl_t** link = &wyt_pthreads_fiber_pool; *link != NULL; link = &(*link)->next)
+    {
+        if ((*link)->size == size)
+        {
+            self = *link;
+            *link = self->next;
+            --wyt_pthreads_fiber_pooled;
+            break;
+        }
+    }
+    /// @see pthread_mutex_unlock | <pthread.h> [libpthread] (POSIX.1) | https://man7.org/linux/man-pages/man3/pthread_mutex_unlock.3p.html
+    (void)pthread_mutex_unlock(&wyt_pthreads_fiber_lock);
+
+    if (self == NULL)
+    {
+    #ifdef __APPLE__
+        const int flags = MAP_PRIVATE | MAP_ANON;
+    #else
+        const int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_STACK;
+    #endif
+        /// @see mmap | <sys/mman.h> [libc] (POSIX.1) | https://man7.org/linux/man-pages/man2/mmap.2.html | https://www.unix.com/man-page/mojave/2/mmap/
+        unsigned char* const base = mmap(NULL, size, PROT_READ | PROT_WRITE, flags, -1, 0);
+        if (base == MAP_FAILED) return NULL;
+
+        // The lowest page catches stack overflows.
+        /// @see mprotect | <sys/mman.h> [libc] (POSIX.1) | https://man7.org/linux/man-pages/man2/mprotect.2.html | https://www.unix.com/man-page/mojave/2/mprotect/
+        if (mprotect(base, page, PROT_NONE) != 0)
+        {
+            /// @see munmap | <sys/mman.h> [libc] (POSIX.1) | https://man7.org/linux/man-pages/man2/munmap.2.html | https://www.unix.com/man-page/mojave/2/munmap/
+            (void)munmap(base, size);
+            return NULL;
+        }
+
+        const uintptr_t end = (uintptr_t)(base + size) - sizeof(struct wyt_fiber_impl_t);
+        self = (struct wyt_fiber_impl_t*)(end & ~(uintptr_t)63);
+        self->base = base;
+        self->size = size;
+    }
+
+    self->func = func;
+    self->arg = arg;
+    self->next = NULL;
+
+    unsigned char* const bottom = (unsigned char*)self->base + page;
+    unsigned char* const top = (unsigned char*)self;
+    wyt_pthreads_fiber_init(self, bottom, top);
+    return self;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_fiber_destroy(wyt_fiber_t const fiber)
+{
+    struct wyt_fiber_impl_t* const self = (struct wyt_fiber_impl_t*)fiber;
+    WYT_ASSUME(self != NULL);
+    WYT_ASSUME(self->base != NULL);
+    WYT_ASSUME(self != wyt_pthreads_fiber_self);
+
+    (void)pthread_mutex_lock(&wyt_pthreads_fiber_lock);
+    const wyt_bool_t pooled = (wyt_pthreads_fiber_pooled < WYT_FIBER_POOL_MAX);
+    if (pooled)
+    {
+        self->next = wyt_pthreads_fiber_pool;
+        wyt_pthreads_fiber_pool = self;
+        ++wyt_pthreads_fiber_pooled;
+    }
+    (void)pthread_mutex_unlock(&wyt_pthreads_fiber_lock);
+
+    /// @see munmap | <sys/mman.h> [libc] (POSIX.1) | https://man7.org/linux/man-pages/man2/munmap.2.html | https://www.unix.com/man-page/mojave/2/munmap/
+    if (!pooled) (void)munmap(self->base, self->size);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_fiber_t wyt_fiber_current(void)
+{
+    return wyt_pthreads_fiber_current();
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_fiber_switch(wyt_fiber_t const fiber)
+{
+    struct wyt_fiber_impl_t* const self = wyt_pthreads_fiber_current();
+    struct wyt_fiber_impl_t* const next = (struct wyt_fiber_impl_t*)fiber;
+    WYT_ASSUME(next != NULL);
+    WYT_ASSUME(!next->done);
+
+    if (next == self) return;
+
+    next->resumer = self;
+    wyt_pthreads_fiber_self = next;
+
+#ifdef WYT_PTHREADS_FIBER_ASM
+    wyt_pthreads_jump(&self->sp, next->sp);
+#else
+    /// @see swapcontext | <ucontext.h> [libc] (POSIX.1-2001) | https://man7.org/linux/man-pages/man3/swapcontext.3.html
+    const int res = swapcontext(&self->context, &next->context);
+    WYT_ASSERT(res == 0);
+#endif
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_arena_t wyt_arena_local(void)
+{
+    if (wyt_pthreads_arena_local != NULL) return wyt_pthreads_arena_local;
+
+    /// @see pthread_once | <pthread.h> [libpthread] (POSIX.1) | https://man7.org/linux/man-pages/man3/pthread_once.3p.html
+    const int res_once = pthread_once(&wyt_pthreads_arena_once, wyt_pthreads_arena_init);
+    if ((res_once != 0) || (wyt_pthreads_arena_error != 0)) return NULL;
+
+    wyt_arena_t const self = wyt_arena_create(0);
+    if (self == NULL) return NULL;
+
+    /// @see pthread_setspecific | <pthread.h> [libpthread] (POSIX.1) | https://man7.org/linux/man-pages/man3/pthread_setspecific.3p.html
+    if (pthread_setspecific(wyt_pthreads_arena_key, self) != 0)
+    {
+        wyt_arena_destroy(self);
+        return NULL;
+    }
+
+    wyt_pthreads_arena_local = self;
+    return self;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_tls_t wyt_tls_create(wyt_tls_destructor_t const destructor)
+{
+    /// @see malloc | <stdlib.h> [libc] (POSIX.1) | https://en.cppreference.com/w/c/memory/malloc
+    struct wyt_tls_impl_t* const self = malloc(sizeof(struct wyt_tls_impl_t));
+    if (self == NULL) return NULL;
+
+    self->destructor = destructor;
+
+    // Values live in a thread-local array, so a native key is only needed to run destructors.
+    /// @see pthread_key_create | <pthread.h> [libpthread] (POSIX.1) | https://man7.org/linux/man-pages/man3/pthread_key_create.3p.html
+    if ((destructor != NULL) && (pthread_key_create(&self->key, wyt_pthreads_tls_exit) != 0))
+    {
+        /// @see free | <stdlib.h> [libc] (POSIX.1) | https://en.cppreference.com/w/c/memory/free
+        free(self);
+        return NULL;
+    }
+
+    /// @see pthread_mutex_lock | <pthread.h> [libpthread] (POSIX.1) | https://man7.org/linux/man-pages/man3/pthread_mutex_lock.3p.html
+    (void)pthread_mutex_lock(&wyt_pthreads_tls_lock);
+    self->id = ++wyt_pthreads_tls_ids;
+    self->slot = WYT_TLS_SLOTS;
+    for (unsigned int slot = 0; slot < WYT_TLS_SLOTS; ++slot)
+    {
+        if (wyt_pthreads_tls_keys[slot] == NULL)
+        {
+            wyt_pthreads_tls_keys[slot] = self;
+            self->slot = slot;
+            break;
+        }
+    }
+    /// @see pthread_mutex_unlock | <pthread.h> [libpthread] (POSIX.1) | https://man7.org/linux/man-pages/man3/pthread_mutex_unlock.3p.html
+    (void)pthread_mutex_unlock(&wyt_pthreads_tls_lock);
+
+    if (self->slot == WYT_TLS_SLOTS)
+    {
+        /// @see pthread_key_delete | <pthread.h> [libpthread] (POSIX.1) | https://man7.org/linux/man-pages/man3/pthread_key_delete.3p.html
+        if (destructor != NULL) (void)pthread_key_delete(self->key);
+        free(self);
+        return NULL;
+    }
+
+    return self;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_tls_destroy(wyt_tls_t const tls)
+{
+    struct wyt_tls_impl_t* const self = (struct wyt_tls_impl_t*)tls;
+    WYT_ASSUME(self != NULL);
+
+    /// @see pthread_key_delete | <pthread.h> [libpthread] (POSIX.1) | https://man7.org/linux/man-pages/man3/pthread_key_delete.3p.html
+    if (self->destructor != NULL) (void)pthread_key_delete(self->key);
+
+    // Entries of other threads still holding the ID are ignored, since a new key never reuses it.
+    /// @see pthread_mutex_lock | <pthread.h> [libpthread] (POSIX.1) | https://man7.org/linux/man-pages/man3/pthread_mutex_lock.3p.html
+    (void)pthread_mutex_lock(&wyt_pthreads_tls_lock);
+    wyt_pthreads_tls_keys[self->slot] = NULL;
+    /// @see pthread_mutex_unlock | <pthread.h> [libpthread] (POSIX.1) | https://man7.org/linux/man-pages/man3/pthread_mutex_unlock.3p.html
+    (void)pthread_mutex_unlock(&wyt_pthreads_tls_lock);
+
+    /// @see free | <stdlib.h> [libc] (POSIX.1) | https://en.cppreference.com/w/c/memory/free
+    free(self);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void* wyt_tls_get(wyt_tls_t const tls)
+{
+    const struct wyt_tls_impl_t* const self = (const struct wyt_tls_impl_t*)tls;
+    WYT_ASSUME(self != NULL);
+
+    const struct wyt_tls_entry_t* const entry = &wyt_pthreads_tls[self->slot];
+    return (entry->id == self->id) ? entry->value : NULL;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_bool_t wyt_tls_set(wyt_tls_t const tls, void* const value)
+{
+    const struct wyt_tls_impl_t* const self = (const struct wyt_tls_impl_t*)tls;
+    WYT_ASSUME(self != NULL);
+
+    struct wyt_tls_entry_t* const entry = &wyt_pthreads_tls[self->slot];
+    const wyt_bool_t was_set = (entry->id == self->id) && (entry->value != NULL);
+
+    // The native key only changes when the value becomes NULL or non-NULL.
+    if ((self->destructor != NULL) && (was_set != (value != NULL)))
+    {
+        /// @see pthread_setspecific | <pthread.h> [libpthread] (POSIX.1) | https://man7.org/linux/man-pages/man3/pthread_setspecific.3p.html
+        if (pthread_setspecific(self->key, (value != NULL) ? entry : NULL) != 0) return false;
+    }
+
+    entry->id = self->id;
+    entry->value = value;
+    return true;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_evsem_t wyt_evsem_create(const int initial)
+{
+    if (initial < 0) return NULL;
+
+    /// @see malloc | <stdlib.h> [libc] (POSIX.1) | https://en.cppreference.com/w/c/memory/malloc | https://man7.org/linux/man-pages/man3/malloc.3.html
+    struct wyt_evsem_impl_t* const self = malloc(sizeof(struct wyt_evsem_impl_t));
+    if (self == NULL) return NULL;
+
+#ifdef __APPLE__
+    int fds[2];
+
+    /// @see pipe | <unistd.h> [libc] (POSIX.1) (macOS 10.0) | https://www.unix.com/man-page/mojave/2/pipe/
+    const int res_pipe = pipe(fds);
+    if (res_pipe == 0)
+    {
+        self->read_fd = fds[0];
+        self->write_fd = fds[1];
+
+        wyt_bool_t success = true;
+        for (int i = 0; i < 2; ++i)
+        {
+            /// @see fcntl | <fcntl.h> [libc] (POSIX.1) (macOS 10.0) | https://www.unix.com/man-page/mojave/2/fcntl/
+            const int res_fd = fcntl(fds[i], F_SETFD, FD_CLOEXEC);
+            const int flags = fcntl(fds[i], F_GETFL);
+            const int res_fl = (flags != -1) ? fcntl(fds[i], F_SETFL, flags | O_NONBLOCK) : -1;
+            success = success && (res_fd != -1) && (res_fl != -1);
+        }
+
+        // The pipe's capacity limits the counter, so large initial values may not fit.
+        for (int count = 0; success && (count < initial); ++count)
+        {
+            success = wyt_evsem_release((wyt_evsem_t)self);
+        }
+
+        if (success) return (wyt_evsem_t)self;
+
+        /// @see close | <unistd.h> [libc] (POSIX.1) (macOS 10.0) | https://www.unix.com/man-page/mojave/2/close/
+        (void)close(fds[0]);
+        (void)close(fds[1]);
+    }
+#else
+    /// @see eventfd | <sys/eventfd.h> [libc] (Linux 2.6.22) | https://man7.org/linux/man-pages/man2/eventfd.2.html
+    /// @see EFD_SEMAPHORE | <sys/eventfd.h> (Linux 2.6.30)
+    const int fd = eventfd((unsigned int)initial, EFD_SEMAPHORE | EFD_NONBLOCK | EFD_CLOEXEC);
+    if (fd != -1)
+    {
+        self->read_fd = fd;
+        self->write_fd = fd;
+        return (wyt_evsem_t)self;
+    }
+#endif
+
+    /// @see free | <stdlib.h> [libc] (POSIX.1) | https://en.cppreference.com/w/c/memory/free | https://man7.org/linux/man-pages/man3/free.3.html
+    free(self);
+    return NULL;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_evsem_destroy(wyt_evsem_t const evsem)
+{
+    WYT_ASSUME(evsem != NULL);
+    struct wyt_evsem_impl_t* const self = (struct wyt_evsem_impl_t*)evsem;
+
+    /// @see close | <unistd.h> [libc] (POSIX.1) (macOS 10.0) | https://man7.org/linux/man-pages/man2/close.2.html | https://www.unix.com/man-page/mojave/2/close/
+    const int res_read = close(self->read_fd);
+    WYT_ASSERT(res_read == 0);
+
+    if (self->write_fd != self->read_fd)
+    {
+        const int res_write = close(self->write_fd);
+        WYT_ASSERT(res_write == 0);
+    }
+
+    /// @see free | <stdlib.h> [libc] (POSIX.1) | https://en.cppreference.com/w/c/memory/free | https://man7.org/linux/man-pages/man3/free.3.html
+    free(self);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_bool_t wyt_evsem_release(wyt_evsem_t const evsem)
+{
+    WYT_ASSUME(evsem != NULL);
+    const struct wyt_evsem_impl_t* const self = (const struct wyt_evsem_impl_t*)evsem;
+
+#ifdef __APPLE__
+    const unsigned char val = 1;
+#else
+    const uint64_t val = 1;
+#endif
+
+    ssize_t res;
+    do {
+        /// @see write | <unistd.h> [libc] (POSIX.1) (macOS 10.0) | https://man7.org/linux/man-pages/man2/write.2.html | https://www.unix.com/man-page/mojave/2/write/
+        res = write(self->write_fd, &val, sizeof(val));
+    } while ((res == -1) && (errno == EINTR));
+
+    // Writes fail with `EAGAIN` once the counter is at its maximum.
+    return res == (ssize_t)sizeof(val);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_evsem_acquire(wyt_evsem_t const evsem)
+{
+    const size_t res = wyt_wait_any(&evsem, 1, WYT_FOREVER);
+    WYT_ASSERT(res == 0);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_bool_t wyt_evsem_try_acquire(wyt_evsem_t const evsem)
+{
+    WYT_ASSUME(evsem != NULL);
+    const struct wyt_evsem_impl_t* const self = (const struct wyt_evsem_impl_t*)evsem;
+
+    // In semaphore-mode, each read of an eventfd decrements the counter by 1.
+#ifdef __APPLE__
+    unsigned char val;
+#else
+    uint64_t val;
 #endif
+
+    ssize_t res;
+    do {
+        /// @see read | <unistd.h> [libc] (POSIX.1) (macOS 10.0) | https://man7.org/linux/man-pages/man2/read.2.html | https://www.unix.com/man-page/mojave/2/read/
+        res = read(self->read_fd, &val, sizeof(val));
+    } while ((res == -1) && (errno == EINTR));
+
+    WYT_ASSERT((res == (ssize_t)sizeof(val)) || ((res == -1) && ((errno == EAGAIN) || (errno == EWOULDBLOCK))));
+    return res == (ssize_t)sizeof(val);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void* wyt_evsem_native(wyt_evsem_t const evsem)
+{
+    WYT_ASSUME(evsem != NULL);
+    const struct wyt_evsem_impl_t* const self = (const struct wyt_evsem_impl_t*)evsem;
+
+    return (void*)(intptr_t)self->read_fd;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern size_t wyt_wait_any(const wyt_evsem_t* const evsems, size_t const count, wyt_utime_t const deadline)
+{
+    WYT_ASSUME((evsems != NULL) && (count != 0) && (count <= WYT_WAIT_ANY_MAX));
+
+    /// @see pollfd | <poll.h> (POSIX.1) | https://man7.org/linux/man-pages/man2/poll.2.html | https://www.unix.com/man-page/mojave/2/poll/
+    struct pollfd fds[WYT_WAIT_ANY_MAX];
+    for (size_t i = 0; i < count; ++i)
+    {
+        const struct wyt_evsem_impl_t* const self = (const struct wyt_evsem_impl_t*)evsems[i];
+        fds[i] = (struct pollfd){ .fd = self->read_fd, .events = POLLIN, .revents = 0 };
+    }
+
+    for (;;)
+    {
+        const int timeout = wyt_pthreads_timeout(deadline);
+
+        /// @see poll | <poll.h> [libc] (POSIX.1) (macOS 10.3) | https://man7.org/linux/man-pages/man2/poll.2.html | https://www.unix.com/man-page/mojave/2/poll/
+        const int res = poll(fds, (nfds_t)count, timeout);
+        WYT_ASSERT((res != -1) || (errno == EINTR));
+
+        // Several threads may be woken for the same count, so readiness only means the decrement is worth attempting.
+        for (size_t i = 0; (res > 0) && (i < count); ++i)
+        {
+            WYT_ASSERT((fds[i].revents & POLLNVAL) == 0);
+            if ((fds[i].revents != 0) && wyt_evsem_try_acquire(evsems[i])) return i;
+        }
+
+        if (timeout == 0) return count;
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_sem_t wyt_sem_open(const char* const name, const int maximum, const int initial)
+{
+    if ((maximum < initial) || (maximum < 0) || (initial < 0) || (maximum > SEM_VALUE_MAX)) return NULL;
+
+    char path[WYT_NAME_MAX];
+    if (!wyt_pthreads_name(path, name)) return NULL;
+
+    /// @see sem_open | <semaphore.h> [libpthread] (POSIX.1) (macOS 10.4) | https://man7.org/linux/man-pages/man3/sem_open.3.html | https://www.unix.com/man-page/mojave/2/sem_open/
+    sem_t* const ptr = sem_open(path, O_CREAT, 0600, (unsigned int)initial);
+    if (ptr == SEM_FAILED) return NULL;
+
+    // `sem_t` is at least word-aligned, so the lowest bit is free to mark the semaphore as named.
+    return (wyt_sem_t)((uintptr_t)ptr | 1u);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_sem_unlink(const char* const name)
+{
+    char path[WYT_NAME_MAX];
+    if (!wyt_pthreads_name(path, name)) return;
+
+    /// @see sem_unlink | <semaphore.h> [libpthread] (POSIX.1) (macOS 10.4) | https://man7.org/linux/man-pages/man3/sem_unlink.3.html | https://www.unix.com/man-page/mojave/2/sem_unlink/
+    const int res = sem_unlink(path);
+    (void)(res == 0);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_shm_t wyt_shm_open(const char* const name, size_t const size)
+{
+    if (size == 0) return NULL;
+
+    char path[WYT_NAME_MAX];
+    if (!wyt_pthreads_name(path, name)) return NULL;
+
+    /// @see malloc | <stdlib.h> [libc] (POSIX.1) | https://en.cppreference.com/w/c/memory/malloc | https://man7.org/linux/man-pages/man3/malloc.3.html
+    struct wyt_shm_impl_t* const self = malloc(sizeof(struct wyt_shm_impl_t));
+    if (self == NULL) return NULL;
+
+    // Only the process that creates the segment sizes it, so that no other process can observe or truncate it halfway.
+    /// @see shm_open | <sys/mman.h> [librt] (POSIX.1) (macOS 10.4) | https://man7.org/linux/man-pages/man3/shm_open.3.html | https://www.unix.com/man-page/mojave/2/shm_open/
+    int fd = shm_open(path, O_RDWR | O_CREAT | O_EXCL, 0600);
+    const wyt_bool_t created = (fd != -1);
+    if (!created && (errno == EEXIST)) fd = shm_open(path, O_RDWR, 0);
+    if (fd != -1)
+    {
+        wyt_bool_t success;
+
+        if (created)
+        {
+            /// @see ftruncate | <unistd.h> [libc] (POSIX.1) | https://man7.org/linux/man-pages/man2/ftruncate.2.html | https://www.unix.com/man-page/mojave/2/ftruncate/
+            success = (ftruncate(fd, (off_t)size) == 0);
+
+            // An empty segment would stall every other process until it times out, so remove the name.
+            /// @see shm_unlink | <sys/mman.h> [librt] (POSIX.1) (macOS 10.4) | https://man7.org/linux/man-pages/man3/shm_unlink.3.html | https://www.unix.com/man-page/mojave/2/shm_unlink/
+            if (!success) (void)shm_unlink(path);
+        }
+        else
+        {
+            // The creator may not have sized the segment yet. Existing segments may be rounded up to the page size, but must not be smaller.
+            /// @see fstat | <sys/stat.h> [libc] (POSIX.1) | https://man7.org/linux/man-pages/man2/fstat.2.html | https://www.unix.com/man-page/mojave/2/fstat/
+            struct stat info;
+            success = (fstat(fd, &info) == 0);
+            for (unsigned int spin = 0; success && (info.st_size == 0) && (spin < WYT_SHM_SPIN); ++spin)
+            {
+                wyt_yield();
+                success = (fstat(fd, &info) == 0);
+            }
+            success = success && ((unsigned long long)info.st_size >= (unsigned long long)size);
+        }
+
+        if (success)
+        {
+            /// @see mmap | <sys/mman.h> [libc] (POSIX.1) | https://man7.org/linux/man-pages/man2/mmap.2.html | https://www.unix.com/man-page/mojave/2/mmap/
+            self->data = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            self->size = size;
+            success = (self->data != MAP_FAILED);
+        }
+
+        // The mapping keeps the segment alive, so the descriptor is no longer needed.
+        /// @see close | <unistd.h> [libc] (POSIX.1) | https://man7.org/linux/man-pages/man2/close.2.html | https://www.unix.com/man-page/mojave/2/close/
+        (void)close(fd);
+
+        if (success) return (wyt_shm_t)self;
+    }
+
+    /// @see free | <stdlib.h> [libc] (POSIX.1) | https://en.cppreference.com/w/c/memory/free | https://man7.org/linux/man-pages/man3/free.3.html
+    free(self);
+    return NULL;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_shm_close(wyt_shm_t const shm)
+{
+    WYT_ASSUME(shm != NULL);
+    struct wyt_shm_impl_t* const self = (struct wyt_shm_impl_t*)shm;
+
+    /// @see munmap | <sys/mman.h> [libc] (POSIX.1) | https://man7.org/linux/man-pages/man2/munmap.2.html | https://www.unix.com/man-page/mojave/2/munmap/
+    const int res = munmap(self->data, self->size);
+    WYT_ASSERT(res == 0);
+
+    /// @see free | <stdlib.h> [libc] (POSIX.1) | https://en.cppreference.com/w/c/memory/free | https://man7.org/linux/man-pages/man3/free.3.html
+    free(self);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void* wyt_shm_data(wyt_shm_t const shm)
+{
+    WYT_ASSUME(shm != NULL);
+    const struct wyt_shm_impl_t* const self = (const struct wyt_shm_impl_t*)shm;
+
+    return self->data;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern size_t wyt_shm_size(wyt_shm_t const shm)
+{
+    WYT_ASSUME(shm != NULL);
+    const struct wyt_shm_impl_t* const self = (const struct wyt_shm_impl_t*)shm;
+
+    return self->size;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_shm_unlink(const char* const name)
+{
+    char path[WYT_NAME_MAX];
+    if (!wyt_pthreads_name(path, name)) return;
+
+    /// @see shm_unlink | <sys/mman.h> [librt] (POSIX.1) (macOS 10.4) | https://man7.org/linux/man-pages/man3/shm_unlink.3.html | https://www.unix.com/man-page/mojave/2/shm_unlink/
+    const int res = shm_unlink(path);
+    (void)(res == 0);
 }
 
 // ================================================================================================================================
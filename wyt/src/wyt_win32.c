@@ -6,13 +6,20 @@
 #define WIN32_LEAN_AND_MEAN
 
 #include <wyt.h>
+#include "wyt_backend.h"
 
+#include <limits.h>
 #include <stddef.h>
 #include <stdint.h>
+#include <stdatomic.h>
 
 #include <Windows.h>
 #include <process.h>
 
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+    #include <intrin.h>
+#endif
+
 #if (__STDC_VERSION__ <= 201710L)
     #ifdef true
         #undef true
@@ -56,194 +63,1088 @@
     #define WYT_UNREACHABLE() WYT_ASSERT(false)
 #endif
 
+#if defined(_MSC_VER) && !defined(__clang__)
+    /// @see __declspec(thread) | (MSVC) | https://learn.microsoft.com/en-us/cpp/c-language/thread-local-storage
+    #define WYT_THREAD_LOCAL __declspec(thread)
+#else
+    /// @see _Thread_local | (C11) | https://en.cppreference.com/w/c/language/storage_duration
+    #define WYT_THREAD_LOCAL _Thread_local
+#endif
+
 // ================================================================================================================================
 //  Private Declarations
 // --------------------------------------------------------------------------------------------------------------------------------
 
+/**
+ * @brief Implementation of a periodic Ticker.
+ */
+struct wyt_ticker_impl_t
+{
+    wyt_utime_t start;  ///< Timepoint the ticker was created at.
+    wyt_utime_t period; ///< Number of nanoseconds between ticks.
+    wyt_utime_t count;  ///< Number of ticks consumed so far.
+};
+
+/**
+ * @brief Converts a deadline into a timeout for native waits, rounding partial milliseconds up so that waits do not end early.
+ * @details Native timeouts are measured on a different clock, so expiry must only be reported after a wait with a timeout of 0.
+ * @param deadline The timepoint to stop waiting at, or `WYT_FOREVER`.
+ * @return `INFINITE` if `deadline` is `WYT_FOREVER`, 0 if it has passed, or the number of milliseconds until it otherwise.
+ */
+static DWORD wyt_win32_timeout(wyt_utime_t deadline);
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+    #define WYT_WIN32_TSC
+
+#ifdef __SIZEOF_INT128__
+    __extension__ typedef unsigned __int128 wyt_win32_u128_t;
+#endif
+
+/**
+ * @brief Calibration of the CPU's timestamp counter against the Performance Counter.
+ */
+struct wyt_win32_tsc_t
+{
+    wyt_bool_t valid;       ///< Whether the counter is invariant and has been calibrated.
+    wyt_utime_t base_ticks; ///< Counter value at the calibration point.
+    wyt_utime_t base_nanos; ///< Timepoint of `wyt_nanotime` at the calibration point.
+    wyt_utime_t ticks;      ///< Number of ticks elapsed during the calibration window.
+    wyt_utime_t nanos;      ///< Number of nanoseconds elapsed during the calibration window.
+    wyt_utime_t mult;       ///< Nanoseconds per tick, as a 32.32 fixed-point number.
+};
+
+/**
+ * @brief Calibration of the timestamp counter, shared by every thread.
+ */
+static struct wyt_win32_tsc_t wyt_win32_tsc;
+
+/**
+ * @brief Ensures `wyt_win32_tsc` is calibrated exactly once.
+ */
+static INIT_ONCE wyt_win32_tsc_once = INIT_ONCE_STATIC_INIT;
+
+/**
+ * @brief Reads the timestamp counter and `wyt_nanotime` as close together as possible.
+ * @param[out] ticks [non-null] The counter value.
+ * @param[out] nanos [non-null] The matching timepoint of `wyt_nanotime`.
+ */
+static void wyt_win32_tsc_sample(wyt_utime_t* ticks, wyt_utime_t* nanos);
+
+/**
+ * @brief Detects whether the timestamp counter is invariant, and calibrates it if so.
+ * @details Called once, by the first caller of `wyt_nanotime_ex(wyt_clock_tsc)`. Blocks for about 10ms.
+ * @see PINIT_ONCE_FN | <Windows.h> <synchapi.h> | https://learn.microsoft.com/en-us/windows/win32/api/synchapi/nc-synchapi-pinit_once_fn
+ */
+static BOOL CALLBACK wyt_win32_tsc_calibrate(PINIT_ONCE once, PVOID param, PVOID* context);
+#endif
+
+/**
+ * @brief Default size of a fiber's stack, in bytes.
+ */
+#define WYT_FIBER_STACK_DEFAULT ((SIZE_T)256 * 1024)
+
+/**
+ * @brief Granularity of fiber stack reservations, in bytes.
+ */
+#define WYT_FIBER_STACK_GRANULARITY ((SIZE_T)64 * 1024)
+
+/**
+ * @brief Maximum number of destroyed fibers kept for reuse.
+ */
+#define WYT_FIBER_POOL_MAX 64
+
+/**
+ * @brief Implementation of a Fiber.
+ * @details Threads use a thread-local instance, converted to a native fiber on first use.
+ */
+struct wyt_fiber_impl_t
+{
+    LPVOID handle;                    ///< The native fiber.
+    wyt_fiber_entry_t func;           ///< The user's entry-function.
+    void* arg;                        ///< The argument to pass to `func`.
+    struct wyt_fiber_impl_t* resumer; ///< The fiber that most recently switched to this one.
+    struct wyt_fiber_impl_t* next;    ///< The next fiber in the pool of reusable fibers.
+    SIZE_T size;                      ///< The reserved size of the stack, in bytes.
+    wyt_bool_t started;               ///< Whether the native fiber has been switched to since `func` was assigned.
+    wyt_bool_t done;                  ///< Whether `func` has returned.
+};
+
+/**
+ * @brief The fiber representing the current thread itself.
+ */
+static WYT_THREAD_LOCAL struct wyt_fiber_impl_t wyt_win32_fiber_root;
+
+/**
+ * @brief The fiber running on the current thread, or NULL if fibers have not been used yet.
+ */
+static WYT_THREAD_LOCAL struct wyt_fiber_impl_t* wyt_win32_fiber_self;
+
+/**
+ * @brief Protects `wyt_win32_fiber_pool` and `wyt_win32_fiber_pooled`.
+ */
+static SRWLOCK wyt_win32_fiber_lock = SRWLOCK_INIT;
+
+/**
+ * @brief Singly-linked list of finished fibers that can be reused.
+ */
+static struct wyt_fiber_impl_t* wyt_win32_fiber_pool;
+
+/**
+ * @brief The number of fibers in `wyt_win32_fiber_pool`, at most `WYT_FIBER_POOL_MAX`.
+ */
+static unsigned int wyt_win32_fiber_pooled;
+
+/**
+ * @brief Returns the implementation of the current fiber, lazily converting the thread itself into a fiber.
+ */
+static struct wyt_fiber_impl_t* wyt_win32_fiber_current(void);
+
+/**
+ * @brief Entry-point of every native fiber. Runs the user's entry-function, then switches back to the fiber's last resumer.
+ * @details Pooled fibers are reused by switching back into the loop with a new entry-function.
+ * @param[in] param [non-null] The fiber.
+ * @see LPFIBER_START_ROUTINE | <Windows.h> <winbase.h> | https://learn.microsoft.com/en-us/windows/win32/api/winbase/nc-winbase-pfiber_start_routine
+ */
+static VOID CALLBACK wyt_win32_fiber_main(LPVOID param);
+
+/**
+ * @brief Fiber-local slot holding the arena returned by `wyt_arena_local`, whose destructor destroys it.
+ */
+static DWORD wyt_win32_arena_fls = FLS_OUT_OF_INDEXES;
+
+/**
+ * @brief Ensures `wyt_win32_arena_fls` is allocated exactly once.
+ */
+static INIT_ONCE wyt_win32_arena_once = INIT_ONCE_STATIC_INIT;
+
+/**
+ * @brief Allocates the fiber-local slot whose destructor destroys the arenas returned by `wyt_arena_local`.
+ * @see PINIT_ONCE_FN | <Windows.h> <synchapi.h> | https://learn.microsoft.com/en-us/windows/win32/api/synchapi/nc-synchapi-pinit_once_fn
+ */
+static BOOL CALLBACK wyt_win32_arena_init(PINIT_ONCE once, PVOID param, PVOID* context);
+
+/**
+ * @brief Fiber-local destructor of the arenas returned by `wyt_arena_local`.
+ * @param[in] ptr [non-null] The arena.
+ * @see PFLS_CALLBACK_FUNCTION | <Windows.h> <winnt.h> | https://learn.microsoft.com/en-us/windows/win32/api/winnt/nc-winnt-pfls_callback_function
+ */
+static VOID NTAPI wyt_win32_arena_exit(PVOID ptr);
+
+/**
+ * @brief Maximum number of Thread-Local Storage keys that can exist at the same time.
+ */
+#define WYT_TLS_SLOTS 128u
+
+/**
+ * @brief Implementation of a Thread-Local Storage key.
+ */
+struct wyt_tls_impl_t
+{
+    wyt_tls_destructor_t destructor; ///< The user's destructor, or NULL.
+    unsigned long long id;           ///< The unique ID of the key.
+    unsigned int slot;               ///< The index of the key's entry in each fiber's values.
+};
+
+/**
+ * @brief A fiber's value of the Thread-Local Storage key using the same slot.
+ */
+struct wyt_tls_entry_t
+{
+    unsigned long long id; ///< The unique ID of the key the value belongs to. Stale IDs belong to destroyed keys.
+    void* value;           ///< The fiber's value.
+};
+
+/**
+ * @brief The values of every Thread-Local Storage key of a fiber.
+ * @details Allocated when the fiber first sets a value, and only ever referenced by its native fiber-local slot.
+ */
+struct wyt_tls_values_t
+{
+    struct wyt_tls_entry_t entries[WYT_TLS_SLOTS]; ///< The values, indexed by the slot of their key.
+};
+
+/**
+ * @brief Fiber-local slot holding each fiber's `wyt_tls_values_t`.
+ */
+static DWORD wyt_win32_tls_fls = FLS_OUT_OF_INDEXES;
+
+/**
+ * @brief Ensures `wyt_win32_tls_fls` is allocated exactly once.
+ */
+static INIT_ONCE wyt_win32_tls_once = INIT_ONCE_STATIC_INIT;
+
+/**
+ * @brief Protects `wyt_win32_tls_keys` and `wyt_win32_tls_ids`.
+ */
+static SRWLOCK wyt_win32_tls_lock = SRWLOCK_INIT;
+
+/**
+ * @brief The key using each slot, or NULL.
+ */
+static struct wyt_tls_impl_t* wyt_win32_tls_keys[WYT_TLS_SLOTS];
+
+/**
+ * @brief The last ID given to a key.
+ */
+static unsigned long long wyt_win32_tls_ids;
+
+/**
+ * @brief Allocates the fiber-local slot that holds the values of every Thread-Local Storage key.
+ * @see PINIT_ONCE_FN | <Windows.h> <synchapi.h> | https://learn.microsoft.com/en-us/windows/win32/api/synchapi/nc-synchapi-pinit_once_fn
+ */
+static BOOL CALLBACK wyt_win32_tls_init(PINIT_ONCE once, PVOID param, PVOID* context);
+
+/**
+ * @brief Fiber-local destructor of the values of Thread-Local Storage keys.
+ * @details Called when the fiber that set the values is deleted, or its thread exits, which may happen on another fiber.
+ * @param[in] ptr [non-null] The fiber's `wyt_tls_values_t`, which is freed after calling the destructor of each value.
+ * @see PFLS_CALLBACK_FUNCTION | <Windows.h> <winnt.h> | https://learn.microsoft.com/en-us/windows/win32/api/winnt/nc-winnt-pfls_callback_function
+ */
+static VOID NTAPI wyt_win32_tls_exit(PVOID ptr);
+
+/**
+ * @brief Start-up information for threads that must be configured or signal their exit.
+ */
+struct wyt_win32_start_t
+{
+    wyt_entry_t func;        ///< The user's entry-function.
+    void* arg;               ///< The argument to pass to `func`.
+    wyt_evsem_t exit_signal; ///< [nullable] The Waitable Semaphore to release when the thread exits.
+    wyt_bool_t abort;        ///< Set if configuring the thread failed, so it must return without calling `func`.
+};
+
+/**
+ * @brief Semaphore to release when the current thread exits, or NULL if it has none or it has already been released.
+ */
+static WYT_THREAD_LOCAL wyt_evsem_t wyt_win32_exit_signal;
+
+/**
+ * @brief Entry-function for threads spawned with a `wyt_win32_start_t`.
+ * @param[in] ptr [non-null] Pointer to a heap-allocated `wyt_win32_start_t`, which is freed by this function.
+ */
+static wyt_retval_t WYT_ENTRY wyt_win32_start(void* ptr);
+
+/**
+ * @brief Releases the `exit_signal` of the current thread, if it has one that has not been released yet.
+ */
+static void wyt_win32_signal_exit(void);
+
+/**
+ * @brief Maximum length of the name of a named object, including its suffix and null-terminator.
+ */
+#define WYT_NAME_MAX 256u
+
+/**
+ * @brief Implementation of a mapped Shared Memory segment.
+ */
+struct wyt_shm_impl_t
+{
+    HANDLE mapping; ///< The File Mapping object backed by the paging file.
+    void* data;     ///< The address the segment is mapped at.
+    size_t size;    ///< The size of the segment in bytes.
+};
+
+/**
+ * @brief Converts the name of a named object into UTF-16, appending a suffix for the kind of object.
+ * @details All kernel objects share a single namespace, so the suffix keeps objects of different kinds from colliding.
+ * @param[out] path [non-null] Receives the converted name.
+ * @return `true` if the name fits, `false` otherwise.
+ */
+static wyt_bool_t wyt_win32_name(WCHAR path[WYT_NAME_MAX], const char* name, const WCHAR* suffix);
+
 // ================================================================================================================================
 //  Private Definitions
 // --------------------------------------------------------------------------------------------------------------------------------
 
-// ================================================================================================================================
-//  Public Definitions
+static DWORD wyt_win32_timeout(wyt_utime_t const deadline)
+{
+    if (deadline == WYT_FOREVER) return INFINITE;
+
+    // Finite deadlines must never become `INFINITE`.
+    const wyt_utime_t now = wyt_nanotime();
+    const wyt_utime_t millis = (now < deadline) ? (deadline - now + 999999uLL) / 1000000uLL : 0;
+    return (millis < (wyt_utime_t)INFINITE) ? (DWORD)millis : (INFINITE - 1u);
+}
+
+#ifdef WYT_WIN32_TSC
 // --------------------------------------------------------------------------------------------------------------------------------
 
-extern wyt_utime_t wyt_nanotime(void)
+static void wyt_win32_tsc_sample(wyt_utime_t* const ticks, wyt_utime_t* const nanos)
 {
-    /// @see LARGE_INTEGER | <Windows.h> <winnt.h> | https://learn.microsoft.com/en-us/windows/win32/api/winnt/ns-winnt-large_integer-r1
-    LARGE_INTEGER qpf, qpc;
-    /// @see QueryPerformanceCounter | <Windows.h> <profileapi.h> [Kernel32] (Windows 2000) | https://learn.microsoft.com/en-us/windows/win32/api/profileapi/nf-profileapi-queryperformancecounter
-    (void)QueryPerformanceCounter(&qpc);
-    /// @see QueryPerformanceFrequency | <Windows.h> <profileapi.h> [Kernel32] (Windows 2000) | https://learn.microsoft.com/en-us/windows/win32/api/profileapi/nf-profileapi-queryperformancefrequency
-    (void)QueryPerformanceFrequency(&qpf);
+    // Keep the sample with the narrowest bracket, to minimize the error from preemption.
+    wyt_utime_t best = ~(wyt_utime_t)0;
+    for (int i = 0; i < 8; ++i)
+    {
+        const wyt_utime_t before = wyt_nanotime();
+        /// @see __rdtsc | <intrin.h> (MSVC) | https://learn.microsoft.com/en-us/cpp/intrinsics/rdtsc
+        const wyt_utime_t counter = (wyt_utime_t)__rdtsc();
+        const wyt_utime_t after = wyt_nanotime();
 
-    if ((wyt_utime_t)qpf.QuadPart == 10000000uLL) // Optimize for common 10 MHz frequency.
-        return (wyt_utime_t)qpc.QuadPart * 100uLL;
-    else
-        return wyt_scale((wyt_utime_t)qpc.QuadPart, 1000000000uLL, (wyt_utime_t)qpf.QuadPart);
+        if (after - before < best)
+        {
+            best = after - before;
+            *ticks = counter;
+            *nanos = before + (after - before) / 2;
+        }
+    }
 }
 
 // --------------------------------------------------------------------------------------------------------------------------------
 
-extern void wyt_nanosleep_for(wyt_stime_t const duration)
+static BOOL CALLBACK wyt_win32_tsc_calibrate(PINIT_ONCE const once, PVOID const param, PVOID* const context)
 {
-    if (duration <= 0) return;
+    (void)once;
+    (void)param;
+    (void)context;
 
-    /// @see CreateWaitableTimerExW | <Windows.h> <synchapi.h> [Kernel32] (Windows Vista) | https://learn.microsoft.com/en-us/windows/win32/api/synchapi/nf-synchapi-createwaitabletimerexw
-    const HANDLE timer = CreateWaitableTimerExW(NULL, NULL, CREATE_WAITABLE_TIMER_MANUAL_RESET | CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, SYNCHRONIZE | TIMER_MODIFY_STATE);
-    WYT_ASSERT(timer != NULL);
+    // CPUID.80000007H:EDX[8] reports an invariant TSC, which ticks at a constant rate regardless of P/C-states.
+    /// @see __cpuid | <intrin.h> (MSVC) | https://learn.microsoft.com/en-us/cpp/intrinsics/cpuid-cpuidex
+    int regs[4];
+    __cpuid(regs, (int)0x80000000u);
+    if ((unsigned int)regs[0] < 0x80000007u) return TRUE;
+    __cpuid(regs, (int)0x80000007u);
+    if (!((unsigned int)regs[3] & (1u << 8))) return TRUE;
 
-    /// @see SetWaitableTimer | <Windows.h> <synchapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/synchapi/nf-synchapi-setwaitabletimer
-    const LARGE_INTEGER due = { .QuadPart = duration / -100 };
-    const BOOL res1 = SetWaitableTimer(timer, &due, 0, NULL, NULL, FALSE);
-    WYT_ASSERT(res1 != 0);
+    wyt_utime_t start_ticks, start_nanos;
+    wyt_utime_t base_ticks, base_nanos;
+    wyt_win32_tsc_sample(&start_ticks, &start_nanos);
+    wyt_nanosleep_for(10000000);
+    wyt_win32_tsc_sample(&base_ticks, &base_nanos);
 
-    /// @see WaitForSingleObject | <Windows.h> <synchapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/synchapi/nf-synchapi-waitforsingleobject
-    const DWORD obj = WaitForSingleObject(timer, INFINITE);
-    WYT_ASSERT(obj == WAIT_OBJECT_0);
-        
-    /// @see CloseHandle | <Windows.h> <handleapi.h> [Kernel32] (Windows 2000) | https://learn.microsoft.com/en-us/windows/win32/api/handleapi/nf-handleapi-closehandle
-    const BOOL res2 = CloseHandle(timer);
-    WYT_ASSERT(res2 != 0);
+    const wyt_utime_t ticks = base_ticks - start_ticks;
+    const wyt_utime_t nanos = base_nanos - start_nanos;
+    if ((ticks == 0) || (nanos == 0) || (nanos >= (1uLL << 32))) return TRUE;
+
+    wyt_win32_tsc.base_ticks = base_ticks;
+    wyt_win32_tsc.base_nanos = base_nanos;
+    wyt_win32_tsc.ticks = ticks;
+    wyt_win32_tsc.nanos = nanos;
+    wyt_win32_tsc.mult = (nanos << 32) / ticks;
+    wyt_win32_tsc.valid = true;
+    return TRUE;
 }
+#endif
 
 // --------------------------------------------------------------------------------------------------------------------------------
 
-extern void wyt_nanosleep_until(wyt_utime_t const timepoint)
+static struct wyt_fiber_impl_t* wyt_win32_fiber_current(void)
 {
-    wyt_nanosleep_for((wyt_stime_t)(timepoint - wyt_nanotime()));
+    struct wyt_fiber_impl_t* self = wyt_win32_fiber_self;
+    if (self == NULL)
+    {
+        self = &wyt_win32_fiber_root;
+
+        /// @see IsThreadAFiber | <Windows.h> <fibersapi.h> [Kernel32] (Windows Vista) | https://learn.microsoft.com/en-us/windows/win32/api/fibersapi/nf-fibersapi-isthreadafiber
+        if (IsThreadAFiber())
+        {
+            /// @see GetCurrentFiber | <Windows.h> <winnt.h> (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/winnt/nf-winnt-getcurrentfiber
+            self->handle = GetCurrentFiber();
+        }
+        else
+        {
+            /// @see ConvertThreadToFiberEx | <Windows.h> <winbase.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/winbase/nf-winbase-convertthreadtofiberex
+            self->handle = ConvertThreadToFiberEx(NULL, FIBER_FLAG_FLOAT_SWITCH);
+            WYT_ASSERT(self->handle != NULL);
+        }
+
+        wyt_win32_fiber_self = self;
+    }
+    return self;
 }
 
 // --------------------------------------------------------------------------------------------------------------------------------
 
-extern void wyt_yield(void)
+static VOID CALLBACK wyt_win32_fiber_main(LPVOID const param)
 {
-    /// @see Sleep | <Windows.h> <synchapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/synchapi/nf-synchapi-sleep
-    Sleep(0);
+    struct wyt_fiber_impl_t* const self = (struct wyt_fiber_impl_t*)param;
+
+    for (;;)
+    {
+        self->func(self->arg);
+        self->done = true;
+
+        struct wyt_fiber_impl_t* const next = self->resumer;
+        wyt_win32_fiber_self = next;
+
+        /// @see SwitchToFiber | <Windows.h> <winbase.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/winbase/nf-winbase-switchtofiber
+        SwitchToFiber(next->handle);
+    }
 }
 
 // --------------------------------------------------------------------------------------------------------------------------------
 
-extern wyt_thread_t wyt_spawn(wyt_entry_t const func, void* const arg)
+static BOOL CALLBACK wyt_win32_arena_init(PINIT_ONCE const once, PVOID const param, PVOID* const context)
 {
-    WYT_ASSUME(func != NULL);
-    
-#ifdef _VC_NODEFAULTLIB
-    /// @see CreateThread | <Windows.h> <processthreadsapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/processthreadsapi/nf-processthreadsapi-createthread
-    const HANDLE handle = CreateThread(NULL, 0, func, arg, 0, NULL);
-#else
-    /// @see _beginthreadex | <process.h> [CRT] | https://learn.microsoft.com/en-us/cpp/c-runtime-library/reference/beginthread-beginthreadex
-    const uintptr_t handle = _beginthreadex(NULL, 0, func, arg, 0, NULL);
-#endif
-    return (wyt_thread_t)handle;
+    (void)once;
+    (void)param;
+    (void)context;
+
+    /// @see FlsAlloc | <Windows.h> <fibersapi.h> [Kernel32] (Windows Vista) | https://learn.microsoft.com/en-us/windows/win32/api/fibersapi/nf-fibersapi-flsalloc
+    wyt_win32_arena_fls = FlsAlloc(wyt_win32_arena_exit);
+    return wyt_win32_arena_fls != FLS_OUT_OF_INDEXES;
 }
 
 // --------------------------------------------------------------------------------------------------------------------------------
 
-WYT_NORETURN extern void wyt_exit(wyt_retval_t const retval)
+static VOID NTAPI wyt_win32_arena_exit(PVOID const ptr)
 {
-#ifdef _VC_NODEFAULTLIB
-    /// @see ExitThread | <Windows.h> <processthreadsapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/processthreadsapi/nf-processthreadsapi-exitthread
-    ExitThread(retval);
-#else
-    /// @see _endthreadex | <process.h> [CRT] | https://learn.microsoft.com/en-us/cpp/c-runtime-library/reference/endthread-endthreadex
-    _endthreadex(retval);
-#endif
+    // Deleting a fiber runs this on the deleting fiber, so only the arena passed in may be touched.
+    wyt_arena_destroy((wyt_arena_t)ptr);
+}
 
-    WYT_UNREACHABLE();
+// --------------------------------------------------------------------------------------------------------------------------------
+
+static BOOL CALLBACK wyt_win32_tls_init(PINIT_ONCE const once, PVOID const param, PVOID* const context)
+{
+    (void)once;
+    (void)param;
+    (void)context;
+
+    /// @see FlsAlloc | <Windows.h> <fibersapi.h> [Kernel32] (Windows Vista) | https://learn.microsoft.com/en-us/windows/win32/api/fibersapi/nf-fibersapi-flsalloc
+    wyt_win32_tls_fls = FlsAlloc(wyt_win32_tls_exit);
+    return wyt_win32_tls_fls != FLS_OUT_OF_INDEXES;
 }
 
 // --------------------------------------------------------------------------------------------------------------------------------
 
-extern wyt_retval_t wyt_join(wyt_thread_t const thread)
+static VOID NTAPI wyt_win32_tls_exit(PVOID const ptr)
 {
-    WYT_ASSUME(thread != NULL);
-    const HANDLE handle = (HANDLE)thread;
+    struct wyt_tls_values_t* const values = (struct wyt_tls_values_t*)ptr;
 
-    /// @see WaitForSingleObject | <Windows.h> <synchapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/synchapi/nf-synchapi-waitforsingleobject
-    const DWORD res_wait = WaitForSingleObject(handle, INFINITE);
-    WYT_ASSERT(res_wait == WAIT_OBJECT_0);
+    for (unsigned int slot = 0; slot < WYT_TLS_SLOTS; ++slot)
+    {
+        struct wyt_tls_entry_t* const entry = &values->entries[slot];
+        if (entry->value == NULL) continue;
 
-    /// @see GetExitCodeThread | <Windows.h> <processthreadsapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/processthreadsapi/nf-processthreadsapi-getexitcodethread
-    DWORD retval;
-    const BOOL res_exit = GetExitCodeThread(handle, &retval);
-    WYT_ASSERT(res_exit != 0);
+        // The destructor is copied under the lock, as the key may be destroyed concurrently.
+        /// @see AcquireSRWLockShared | <Windows.h> <synchapi.h> [Kernel32] (Windows Vista) | https://learn.microsoft.com/en-us/windows/win32/api/synchapi/nf-synchapi-acquiresrwlockshared
+        AcquireSRWLockShared(&wyt_win32_tls_lock);
+        const struct wyt_tls_impl_t* const self = wyt_win32_tls_keys[slot];
+        const wyt_tls_destructor_t destructor = ((self != NULL) && (self->id == entry->id)) ? self->destructor : NULL;
+        /// @see ReleaseSRWLockShared | <Windows.h> <synchapi.h> [Kernel32] (Windows Vista) | https://learn.microsoft.com/en-us/windows/win32/api/synchapi/nf-synchapi-releasesrwlockshared
+        ReleaseSRWLockShared(&wyt_win32_tls_lock);
 
-    /// @see CloseHandle | <Windows.h> <handleapi.h> [Kernel32] (Windows 2000) | https://learn.microsoft.com/en-us/windows/win32/api/handleapi/nf-handleapi-closehandle
-    const BOOL res_close = CloseHandle(handle);
-    WYT_ASSERT(res_close != 0);
+        void* const value = entry->value;
+        entry->value = NULL;
+        if (destructor != NULL) destructor(value);
+    }
 
-    return (wyt_retval_t)retval;
+    /// @see HeapFree | <Windows.h> <heapapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/heapapi/nf-heapapi-heapfree
+    const BOOL res = HeapFree(GetProcessHeap(), 0, values);
+    WYT_ASSERT(res != 0);
 }
 
 // --------------------------------------------------------------------------------------------------------------------------------
 
-extern void wyt_detach(wyt_thread_t const thread)
+static wyt_retval_t WYT_ENTRY wyt_win32_start(void* const ptr)
 {
-    WYT_ASSUME(thread != NULL);
-    const HANDLE handle = (HANDLE)thread;
+    const struct wyt_win32_start_t start = *(struct wyt_win32_start_t*)ptr;
 
-    /// @see CloseHandle | <Windows.h> <handleapi.h> [Kernel32] (Windows 2000) | https://learn.microsoft.com/en-us/windows/win32/api/handleapi/nf-handleapi-closehandle
-    const BOOL res = CloseHandle(handle);
-    WYT_ASSERT(res != 0);
+    /// @see HeapFree | <Windows.h> <heapapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/heapapi/nf-heapapi-heapfree
+    const BOOL res_free = HeapFree(GetProcessHeap(), 0, ptr);
+    WYT_ASSERT(res_free != 0);
+
+    // Returning normally lets the C runtime free its per-thread data, which terminating the thread would leak.
+    if (start.abort) return (wyt_retval_t)0;
+
+    // `wyt_exit` releases the signal itself, as the thread never returns here.
+    wyt_win32_exit_signal = start.exit_signal;
+    const wyt_retval_t retval = start.func(start.arg);
+    wyt_win32_signal_exit();
+
+    return retval;
 }
 
 // --------------------------------------------------------------------------------------------------------------------------------
 
-extern wyt_tid_t wyt_tid(void)
+static void wyt_win32_signal_exit(void)
 {
-    /// @see GetCurrentThreadId | <Windows.h> <processthreadsapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/processthreadsapi/nf-processthreadsapi-getcurrentthreadid
-    return (wyt_tid_t)GetCurrentThreadId();
+    const wyt_evsem_t evsem = wyt_win32_exit_signal;
+    if (evsem == NULL) return;
+
+    wyt_win32_exit_signal = NULL;
+    (void)wyt_evsem_release(evsem);
 }
 
 // --------------------------------------------------------------------------------------------------------------------------------
 
-extern wyt_pid_t wyt_pid(void)
+static wyt_bool_t wyt_win32_name(WCHAR path[WYT_NAME_MAX], const char* const name, const WCHAR* const suffix)
 {
-    /// @see GetCurrentProcessId | <Windows.h> <processthreadsapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/processthreadsapi/nf-processthreadsapi-getcurrentprocessid
-    return (wyt_pid_t)GetCurrentProcessId();
+    WYT_ASSUME((name != NULL) && (suffix != NULL));
+
+    /// @see MultiByteToWideChar | <Windows.h> <stringapiset.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/stringapiset/nf-stringapiset-multibytetowidechar
+    const int res = MultiByteToWideChar(CP_UTF8, MB_ERR_INVALID_CHARS, name, -1, path, (int)WYT_NAME_MAX);
+    if (res <= 1) return false;
+
+    size_t len = (size_t)res - 1u;
+    for (size_t i = 0; suffix[i] != L'\0'; ++i)
+    {
+        if (len + 1u >= WYT_NAME_MAX) return false;
+        path[len++] = suffix[i];
+    }
+    path[len] = L'\0';
+
+    return true;
 }
 
 // --------------------------------------------------------------------------------------------------------------------------------
 
-extern wyt_sem_t wyt_sem_create(const int maximum, const int initial)
+extern void* wyt_backend_alloc(size_t const size)
 {
-    if ((maximum < initial) || (maximum < 0) || (initial < 0)) return NULL;
-    
-    /// @see CreateSemaphoreExW | <Windows.h> <winbase.h> [Kernel32] (Windows Vista) | https://learn.microsoft.com/en-us/windows/win32/api/winbase/nf-winbase-createsemaphoreexa
-    const HANDLE handle = CreateSemaphoreExW(NULL, (LONG)initial, (LONG)maximum, NULL, 0, SYNCHRONIZE | SEMAPHORE_MODIFY_STATE);
-    return (wyt_sem_t)handle;
+    /// @see HeapAlloc | <Windows.h> <heapapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/heapapi/nf-heapapi-heapalloc
+    return HeapAlloc(GetProcessHeap(), 0, size);
 }
 
 // --------------------------------------------------------------------------------------------------------------------------------
 
-extern void wyt_sem_destroy(wyt_sem_t const sem)
+extern void* wyt_backend_realloc(void* const ptr, size_t const size)
 {
-    WYT_ASSUME(sem != NULL);
-    const HANDLE handle = (HANDLE)sem;
+    // Unlike `realloc`, `HeapReAlloc` cannot allocate new memory.
+    if (ptr == NULL) return wyt_backend_alloc(size);
 
-    /// @see CloseHandle | <Windows.h> <handleapi.h> [Kernel32] (Windows 2000) | https://learn.microsoft.com/en-us/windows/win32/api/handleapi/nf-handleapi-closehandle
-    const BOOL res = CloseHandle(handle);
-    WYT_ASSERT(res != 0);
+    /// @see HeapReAlloc | <Windows.h> <heapapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/heapapi/nf-heapapi-heaprealloc
+    return HeapReAlloc(GetProcessHeap(), 0, ptr, size);
 }
 
 // --------------------------------------------------------------------------------------------------------------------------------
 
-extern wyt_bool_t wyt_sem_release(wyt_sem_t const sem)
+extern void wyt_backend_free(void* const ptr)
 {
-    WYT_ASSUME(sem != NULL);
-    const HANDLE handle = (HANDLE)sem;
+    if (ptr == NULL) return;
 
-    /// @see ReleaseSemaphore | <Windows.h> <synchapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/synchapi/nf-synchapi-releasesemaphore
-    return ReleaseSemaphore(handle, 1, NULL) != 0;
+    /// @see HeapFree | <Windows.h> <heapapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/heapapi/nf-heapapi-heapfree
+    const BOOL res = HeapFree(GetProcessHeap(), 0, ptr);
+    WYT_ASSERT(res != 0);
 }
 
 // --------------------------------------------------------------------------------------------------------------------------------
 
-extern void wyt_sem_acquire(wyt_sem_t const sem)
+extern size_t wyt_backend_page_size(void)
 {
-    WYT_ASSUME(sem != NULL);
-    const HANDLE handle = (HANDLE)sem;
+    /// @see GetSystemInfo | <Windows.h> <sysinfoapi.h> [Kernel32] (Windows 2000) | https://learn.microsoft.com/en-us/windows/win32/api/sysinfoapi/nf-sysinfoapi-getsysteminfo
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwPageSize;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void* wyt_backend_map(size_t const size)
+{
+    /// @see VirtualAlloc | <Windows.h> <memoryapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/memoryapi/nf-memoryapi-virtualalloc
+    return VirtualAlloc(NULL, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_backend_unmap(void* const ptr, size_t const size)
+{
+    // The whole reservation is always released, so the size is not needed.
+    (void)size;
+
+    /// @see VirtualFree | <Windows.h> <memoryapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/memoryapi/nf-memoryapi-virtualfree
+    const BOOL res = VirtualFree(ptr, 0, MEM_RELEASE);
+    WYT_ASSERT(res != 0);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_bool_t wyt_backend_shring_open(const char* const name, void** const readable, void** const writable)
+{
+    // `WaitOnAddress` only works within a process, so waiters sleep on named Events instead of the Event Count words.
+    WCHAR path_readable[WYT_NAME_MAX];
+    WCHAR path_writable[WYT_NAME_MAX];
+    if (!wyt_win32_name(path_readable, name, L".readable") || !wyt_win32_name(path_writable, name, L".writable")) return false;
+
+    /// @see CreateEventExW | <Windows.h> <synchapi.h> [Kernel32] (Windows Vista) | https://learn.microsoft.com/en-us/windows/win32/api/synchapi/nf-synchapi-createeventexw
+    const HANDLE event_readable = CreateEventExW(NULL, path_readable, 0, SYNCHRONIZE | EVENT_MODIFY_STATE);
+    const HANDLE event_writable = CreateEventExW(NULL, path_writable, 0, SYNCHRONIZE | EVENT_MODIFY_STATE);
+
+    if ((event_readable != NULL) && (event_writable != NULL))
+    {
+        *readable = (void*)event_readable;
+        *writable = (void*)event_writable;
+        return true;
+    }
+
+    /// @see CloseHandle | <Windows.h> <handleapi.h> [Kernel32] (Windows 2000) | https://learn.microsoft.com/en-us/windows/win32/api/handleapi/nf-handleapi-closehandle
+    if (event_readable != NULL) (void)CloseHandle(event_readable);
+    if (event_writable != NULL) (void)CloseHandle(event_writable);
+    return false;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_backend_shring_close(void* const readable, void* const writable)
+{
+    /// @see CloseHandle | <Windows.h> <handleapi.h> [Kernel32] (Windows 2000) | https://learn.microsoft.com/en-us/windows/win32/api/handleapi/nf-handleapi-closehandle
+    const BOOL res_readable = CloseHandle((HANDLE)readable);
+    WYT_ASSERT(res_readable != 0);
+    const BOOL res_writable = CloseHandle((HANDLE)writable);
+    WYT_ASSERT(res_writable != 0);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_bool_t wyt_backend_shring_wait(void* const event, const void* const address, wyt_word_t const key, wyt_utime_t const deadline)
+{
+    (void)address;
+    (void)key;
+
+    const DWORD timeout = wyt_win32_timeout(deadline);
+
+    // The event may still be set by an earlier notification, in which case the condition is simply re-checked.
+    /// @see WaitForSingleObject | <Windows.h> <synchapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/synchapi/nf-synchapi-waitforsingleobject
+    const DWORD res = WaitForSingleObject((HANDLE)event, timeout);
+    WYT_ASSERT((res == WAIT_OBJECT_0) || (res == WAIT_TIMEOUT));
+
+    return timeout != 0;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_backend_shring_wake(void* const event, const void* const address)
+{
+    (void)address;
+
+    /// @see SetEvent | <Windows.h> <synchapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/synchapi/nf-synchapi-setevent
+    const BOOL res = SetEvent((HANDLE)event);
+    WYT_ASSERT(res != 0);
+}
+
+// ================================================================================================================================
+//  Public Definitions
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_utime_t wyt_nanotime(void)
+{
+    /// @see LARGE_INTEGER | <Windows.h> <winnt.h> | https://learn.microsoft.com/en-us/windows/win32/api/winnt/ns-winnt-large_integer-r1
+    LARGE_INTEGER qpf, qpc;
+    /// @see QueryPerformanceCounter | <Windows.h> <profileapi.h> [Kernel32] (Windows 2000) | https://learn.microsoft.com/en-us/windows/win32/api/profileapi/nf-profileapi-queryperformancecounter
+    (void)QueryPerformanceCounter(&qpc);
+    /// @see QueryPerformanceFrequency | <Windows.h> <profileapi.h> [Kernel32] (Windows 2000) | https://learn.microsoft.com/en-us/windows/win32/api/profileapi/nf-profileapi-queryperformancefrequency
+    (void)QueryPerformanceFrequency(&qpf);
+
+    if ((wyt_utime_t)qpf.QuadPart == 10000000uLL) // Optimize for common 10 MHz frequency.
+        return (wyt_utime_t)qpc.QuadPart * 100uLL;
+    else
+        return wyt_scale((wyt_utime_t)qpc.QuadPart, 1000000000uLL, (wyt_utime_t)qpf.QuadPart);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_utime_t wyt_nanotime_ex(wyt_clock_t const source)
+{
+    switch (source)
+    {
+        case wyt_clock_coarse:
+        {
+            /// @see GetTickCount64 | <Windows.h> <sysinfoapi.h> [Kernel32] (Windows Vista) | https://learn.microsoft.com/en-us/windows/win32/api/sysinfoapi/nf-sysinfoapi-gettickcount64
+            return (wyt_utime_t)GetTickCount64() * 1000000uLL;
+        }
+        case wyt_clock_tsc:
+        {
+        #ifdef WYT_WIN32_TSC
+            /// @see InitOnceExecuteOnce | <Windows.h> <synchapi.h> [Kernel32] (Windows Vista) | https://learn.microsoft.com/en-us/windows/win32/api/synchapi/nf-synchapi-initonceexecuteonce
+            const BOOL res = InitOnceExecuteOnce(&wyt_win32_tsc_once, wyt_win32_tsc_calibrate, NULL, NULL);
+            WYT_ASSERT(res != 0);
+
+            if (wyt_win32_tsc.valid)
+            {
+                // The counters of different cores may be slightly out of sync, so the counter can read behind the calibration point.
+                const wyt_utime_t ticks = (wyt_utime_t)__rdtsc();
+                const wyt_bool_t ahead = ticks >= wyt_win32_tsc.base_ticks;
+                const wyt_utime_t delta = ahead ? (ticks - wyt_win32_tsc.base_ticks) : (wyt_win32_tsc.base_ticks - ticks);
+            #if defined(__SIZEOF_INT128__)
+                const wyt_utime_t elapsed = (wyt_utime_t)(((wyt_win32_u128_t)delta * wyt_win32_tsc.mult) >> 32);
+            #elif defined(_M_X64)
+                /// @see _umul128 | <intrin.h> (MSVC) | https://learn.microsoft.com/en-us/cpp/intrinsics/umul128
+                unsigned __int64 hi;
+                const unsigned __int64 lo = _umul128(delta, wyt_win32_tsc.mult, &hi);
+                const wyt_utime_t elapsed = (lo >> 32) | (hi << 32);
+            #else
+                const wyt_utime_t elapsed = wyt_scale(delta, wyt_win32_tsc.nanos, wyt_win32_tsc.ticks);
+            #endif
+                return ahead ? (wyt_win32_tsc.base_nanos + elapsed) : (wyt_win32_tsc.base_nanos - elapsed);
+            }
+        #endif
+            return wyt_nanotime();
+        }
+        default:
+        {
+            // The Performance Counter is monotonic and never slewed, so it serves every other clock.
+            return wyt_nanotime();
+        }
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_nanosleep_for(wyt_stime_t const duration)
+{
+    if (duration <= 0) return;
+
+    /// @see CreateWaitableTimerExW | <Windows.h> <synchapi.h> [Kernel32] (Windows Vista) | https://learn.microsoft.com/en-us/windows/win32/api/synchapi/nf-synchapi-createwaitabletimerexw
+    const HANDLE timer = CreateWaitableTimerExW(NULL, NULL, CREATE_WAITABLE_TIMER_MANUAL_RESET | CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, SYNCHRONIZE | TIMER_MODIFY_STATE);
+    WYT_ASSERT(timer != NULL);
+
+    /// @see SetWaitableTimer | <Windows.h> <synchapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/synchapi/nf-synchapi-setwaitabletimer
+    const LARGE_INTEGER due = { .QuadPart = duration / -100 };
+    const BOOL res1 = SetWaitableTimer(timer, &due, 0, NULL, NULL, FALSE);
+    WYT_ASSERT(res1 != 0);
+
+    /// @see WaitForSingleObject | <Windows.h> <synchapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/synchapi/nf-synchapi-waitforsingleobject
+    const DWORD obj = WaitForSingleObject(timer, INFINITE);
+    WYT_ASSERT(obj == WAIT_OBJECT_0);
+        
+    /// @see CloseHandle | <Windows.h> <handleapi.h> [Kernel32] (Windows 2000) | https://learn.microsoft.com/en-us/windows/win32/api/handleapi/nf-handleapi-closehandle
+    const BOOL res2 = CloseHandle(timer);
+    WYT_ASSERT(res2 != 0);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_nanosleep_until(wyt_utime_t const timepoint)
+{
+    wyt_nanosleep_for((wyt_stime_t)(timepoint - wyt_nanotime()));
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_utime_t wyt_timer_slack_get(void)
+{
+    return 0;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_bool_t wyt_timer_slack_set(wyt_utime_t const slack)
+{
+    (void)slack;
+    return false;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_bool_t wyt_low_latency(wyt_bool_t const enable)
+{
+    /// @see THREAD_POWER_THROTTLING_STATE | <Windows.h> <processthreadsapi.h> (Windows 10 v1709) | https://learn.microsoft.com/en-us/windows/win32/api/processthreadsapi/ns-processthreadsapi-thread_power_throttling_state
+    THREAD_POWER_THROTTLING_STATE state = {
+        .Version = THREAD_POWER_THROTTLING_CURRENT_VERSION,
+        .ControlMask = enable ? THREAD_POWER_THROTTLING_EXECUTION_SPEED : 0,
+        .StateMask = 0,
+    };
+
+    /// @see SetThreadInformation | <Windows.h> <processthreadsapi.h> [Kernel32] (Windows 8) | https://learn.microsoft.com/en-us/windows/win32/api/processthreadsapi/nf-processthreadsapi-setthreadinformation
+    const BOOL res = SetThreadInformation(GetCurrentThread(), ThreadPowerThrottling, &state, sizeof(state));
+    return res != 0;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_ticker_t wyt_ticker_create(wyt_utime_t const period)
+{
+    if (period == 0) return NULL;
+
+    /// @see HeapAlloc | <Windows.h> <heapapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/heapapi/nf-heapapi-heapalloc
+    struct wyt_ticker_impl_t* const self = HeapAlloc(GetProcessHeap(), 0, sizeof(struct wyt_ticker_impl_t));
+    if (self == NULL) return NULL;
+
+    self->start = wyt_nanotime();
+    self->period = period;
+    self->count = 0;
+
+    return (wyt_ticker_t)self;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_ticker_destroy(wyt_ticker_t const ticker)
+{
+    WYT_ASSUME(ticker != NULL);
+
+    /// @see HeapFree | <Windows.h> <heapapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/heapapi/nf-heapapi-heapfree
+    const BOOL res = HeapFree(GetProcessHeap(), 0, ticker);
+    WYT_ASSERT(res != 0);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_utime_t wyt_ticker_wait(wyt_ticker_t const ticker, wyt_utime_t* const missed)
+{
+    WYT_ASSUME(ticker != NULL);
+    struct wyt_ticker_impl_t* const self = (struct wyt_ticker_impl_t*)ticker;
+
+    wyt_nanosleep_until(self->start + (self->count + 1) * self->period);
+
+    const wyt_utime_t elapsed = (wyt_nanotime() - self->start) / self->period;
+    const wyt_utime_t expired = (elapsed > self->count) ? (elapsed - self->count) : 1;
+
+    self->count += expired;
+    if (missed != NULL) *missed = expired - 1;
+
+    return self->start + self->count * self->period;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_yield(void)
+{
+    /// @see Sleep | <Windows.h> <synchapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/synchapi/nf-synchapi-sleep
+    Sleep(0);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_thread_t wyt_spawn(wyt_entry_t const func, void* const arg)
+{
+    return wyt_spawn_ex(func, arg, NULL);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_thread_t wyt_spawn_ex(wyt_entry_t const func, void* const arg, const wyt_thread_attr_t* const attr)
+{
+    WYT_ASSUME(func != NULL);
+
+    const size_t stack_size = (attr != NULL) ? attr->stack_size : 0;
+    const unsigned stack_arg = (stack_size < UINT_MAX) ? (unsigned)stack_size : UINT_MAX;
+
+    // Threads start suspended when they need configuring, so that they never run with the wrong attributes.
+    /// @see CREATE_SUSPENDED | <Windows.h> <processthreadsapi.h> (Windows XP)
+    /// @see STACK_SIZE_PARAM_IS_A_RESERVATION | <Windows.h> <processthreadsapi.h> (Windows XP)
+    const unsigned flags = ((attr != NULL) ? CREATE_SUSPENDED : 0) | ((stack_size != 0) ? STACK_SIZE_PARAM_IS_A_RESERVATION : 0);
+
+    // Threads only need a trampoline when they may have to be aborted, or have to signal their exit.
+    struct wyt_win32_start_t* start = NULL;
+    if (attr != NULL)
+    {
+        /// @see HeapAlloc | <Windows.h> <heapapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/heapapi/nf-heapapi-heapalloc
+        start = HeapAlloc(GetProcessHeap(), 0, sizeof(struct wyt_win32_start_t));
+        if (start == NULL) return NULL;
+
+        *start = (struct wyt_win32_start_t){ .func = func, .arg = arg, .exit_signal = attr->exit_signal, .abort = false };
+    }
+
+    const wyt_entry_t entry = (start != NULL) ? wyt_win32_start : func;
+    void* const param = (start != NULL) ? (void*)start : arg;
+
+#ifdef _VC_NODEFAULTLIB
+    /// @see CreateThread | <Windows.h> <processthreadsapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/processthreadsapi/nf-processthreadsapi-createthread
+    const HANDLE handle = CreateThread(NULL, stack_arg, entry, param, flags, NULL);
+#else
+    /// @see _beginthreadex | <process.h> [CRT] | https://learn.microsoft.com/en-us/cpp/c-runtime-library/reference/beginthread-beginthreadex
+    const HANDLE handle = (HANDLE)_beginthreadex(NULL, stack_arg, entry, param, flags, NULL);
+#endif
+    if ((handle == NULL) && (start != NULL))
+    {
+        /// @see HeapFree | <Windows.h> <heapapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/heapapi/nf-heapapi-heapfree
+        const BOOL res_free = HeapFree(GetProcessHeap(), 0, start);
+        WYT_ASSERT(res_free != 0);
+    }
+    if ((handle == NULL) || (attr == NULL)) return (wyt_thread_t)handle;
+
+    wyt_bool_t success = true;
+
+    if (attr->name != NULL)
+    {
+        WCHAR name[256];
+
+        /// @see MultiByteToWideChar | <Windows.h> <stringapiset.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/stringapiset/nf-stringapiset-multibytetowidechar
+        const int res_conv = MultiByteToWideChar(CP_UTF8, 0, attr->name, -1, name, (int)(sizeof(name) / sizeof(name[0])));
+        if (res_conv != 0)
+        {
+            /// @see SetThreadDescription | <Windows.h> <processthreadsapi.h> [Kernel32] (Windows 10 v1607) | https://learn.microsoft.com/en-us/windows/win32/api/processthreadsapi/nf-processthreadsapi-setthreaddescription
+            const HRESULT res_name = SetThreadDescription(handle, name);
+            (void)SUCCEEDED(res_name);
+        }
+    }
+
+    if ((attr->affinity != NULL) && (attr->affinity_len != 0))
+    {
+        // Only the first 64 CPUs (the first processor group) can be selected.
+        /// @see SetThreadAffinityMask | <Windows.h> <winbase.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/winbase/nf-winbase-setthreadaffinitymask
+        const DWORD_PTR res_affinity = SetThreadAffinityMask(handle, (DWORD_PTR)attr->affinity[0]);
+        success = success && (res_affinity != 0);
+    }
+
+    if (attr->priority != wyt_priority_default)
+    {
+        int priority;
+        switch (attr->priority)
+        {
+            case wyt_priority_idle:     priority = THREAD_PRIORITY_IDLE;          break;
+            case wyt_priority_low:      priority = THREAD_PRIORITY_BELOW_NORMAL;  break;
+            case wyt_priority_high:     priority = THREAD_PRIORITY_HIGHEST;       break;
+            case wyt_priority_realtime: priority = THREAD_PRIORITY_TIME_CRITICAL; break;
+            default:                    priority = THREAD_PRIORITY_NORMAL;        break;
+        }
+
+        /// @see SetThreadPriority | <Windows.h> <processthreadsapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/processthreadsapi/nf-processthreadsapi-setthreadpriority
+        const BOOL res_priority = SetThreadPriority(handle, priority);
+        success = success && (res_priority != 0);
+    }
+
+    // The thread has not run any user code yet, so it is told to return as soon as it is resumed.
+    // The start block is only read by the thread after `ResumeThread`, which orders this store before it.
+    start->abort = !success;
+
+    /// @see ResumeThread | <Windows.h> <processthreadsapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/processthreadsapi/nf-processthreadsapi-resumethread
+    const DWORD res_resume = ResumeThread(handle);
+    WYT_ASSERT(res_resume != (DWORD)-1);
+
+    if (!success)
+    {
+        /// @see CloseHandle | <Windows.h> <handleapi.h> [Kernel32] (Windows 2000) | https://learn.microsoft.com/en-us/windows/win32/api/handleapi/nf-handleapi-closehandle
+        const BOOL res_close = CloseHandle(handle);
+        WYT_ASSERT(res_close != 0);
+
+        return NULL;
+    }
+
+    return (wyt_thread_t)handle;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+WYT_NORETURN extern void wyt_exit(wyt_retval_t const retval)
+{
+    // Pooled threads report the value through their task.
+    wyt_pooled_exit(retval);
+
+    wyt_win32_signal_exit();
+
+#ifdef _VC_NODEFAULTLIB
+    /// @see ExitThread | <Windows.h> <processthreadsapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/processthreadsapi/nf-processthreadsapi-exitthread
+    ExitThread(retval);
+#else
+    /// @see _endthreadex | <process.h> [CRT] | https://learn.microsoft.com/en-us/cpp/c-runtime-library/reference/endthread-endthreadex
+    _endthreadex(retval);
+#endif
+
+    WYT_UNREACHABLE();
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_retval_t wyt_join(wyt_thread_t const thread)
+{
+    wyt_retval_t retval;
+    const wyt_bool_t res = wyt_join_until(thread, WYT_FOREVER, &retval);
+    WYT_ASSERT(res);
+    return retval;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_bool_t wyt_join_until(wyt_thread_t const thread, wyt_utime_t const deadline, wyt_retval_t* const retval)
+{
+    WYT_ASSUME(thread != NULL);
+
+    // Handles to pooled tasks are tagged, and joined through their task instead.
+    if (((uintptr_t)thread & 1u) != 0) return wyt_pooled_join(thread, deadline, retval);
+
+    const HANDLE handle = (HANDLE)thread;
+
+    for (;;)
+    {
+        const DWORD timeout = wyt_win32_timeout(deadline);
+
+        /// @see WaitForSingleObject | <Windows.h> <synchapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/synchapi/nf-synchapi-waitforsingleobject
+        const DWORD res_wait = WaitForSingleObject(handle, timeout);
+        if (res_wait == WAIT_OBJECT_0) break;
+        WYT_ASSERT(res_wait == WAIT_TIMEOUT);
+
+        if (timeout == 0) return false;
+    }
+
+    /// @see GetExitCodeThread | <Windows.h> <processthreadsapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/processthreadsapi/nf-processthreadsapi-getexitcodethread
+    DWORD code;
+    const BOOL res_exit = GetExitCodeThread(handle, &code);
+    WYT_ASSERT(res_exit != 0);
+
+    /// @see CloseHandle | <Windows.h> <handleapi.h> [Kernel32] (Windows 2000) | https://learn.microsoft.com/en-us/windows/win32/api/handleapi/nf-handleapi-closehandle
+    const BOOL res_close = CloseHandle(handle);
+    WYT_ASSERT(res_close != 0);
+
+    if (retval != NULL) *retval = (wyt_retval_t)code;
+    return true;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_detach(wyt_thread_t const thread)
+{
+    WYT_ASSUME(thread != NULL);
+
+    if (((uintptr_t)thread & 1u) != 0)
+    {
+        wyt_pooled_detach(thread);
+        return;
+    }
+    const HANDLE handle = (HANDLE)thread;
+
+    /// @see CloseHandle | <Windows.h> <handleapi.h> [Kernel32] (Windows 2000) | https://learn.microsoft.com/en-us/windows/win32/api/handleapi/nf-handleapi-closehandle
+    const BOOL res = CloseHandle(handle);
+    WYT_ASSERT(res != 0);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_tid_t wyt_tid(void)
+{
+    /// @see GetCurrentThreadId | <Windows.h> <processthreadsapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/processthreadsapi/nf-processthreadsapi-getcurrentthreadid
+    return (wyt_tid_t)GetCurrentThreadId();
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_pid_t wyt_pid(void)
+{
+    /// @see GetCurrentProcessId | <Windows.h> <processthreadsapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/processthreadsapi/nf-processthreadsapi-getcurrentprocessid
+    return (wyt_pid_t)GetCurrentProcessId();
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_sem_t wyt_sem_create(const int maximum, const int initial)
+{
+    if ((maximum < initial) || (maximum < 0) || (initial < 0)) return NULL;
+    
+    /// @see CreateSemaphoreExW | <Windows.h> <winbase.h> [Kernel32] (Windows Vista) | https://learn.microsoft.com/en-us/windows/win32/api/winbase/nf-winbase-createsemaphoreexa
+    const HANDLE handle = CreateSemaphoreExW(NULL, (LONG)initial, (LONG)maximum, NULL, 0, SYNCHRONIZE | SEMAPHORE_MODIFY_STATE);
+    return (wyt_sem_t)handle;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_sem_destroy(wyt_sem_t const sem)
+{
+    WYT_ASSUME(sem != NULL);
+    const HANDLE handle = (HANDLE)sem;
+
+    /// @see CloseHandle | <Windows.h> <handleapi.h> [Kernel32] (Windows 2000) | https://learn.microsoft.com/en-us/windows/win32/api/handleapi/nf-handleapi-closehandle
+    const BOOL res = CloseHandle(handle);
+    WYT_ASSERT(res != 0);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_bool_t wyt_sem_release(wyt_sem_t const sem)
+{
+    WYT_ASSUME(sem != NULL);
+    const HANDLE handle = (HANDLE)sem;
+
+    /// @see ReleaseSemaphore | <Windows.h> <synchapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/synchapi/nf-synchapi-releasesemaphore
+    return ReleaseSemaphore(handle, 1, NULL) != 0;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_sem_acquire(wyt_sem_t const sem)
+{
+    WYT_ASSUME(sem != NULL);
+    const HANDLE handle = (HANDLE)sem;
 
     /// @see WaitForSingleObject | <Windows.h> <synchapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/synchapi/nf-synchapi-waitforsingleobject
     const DWORD res = WaitForSingleObject(handle, INFINITE);
@@ -262,4 +1163,681 @@ extern wyt_bool_t wyt_sem_try_acquire(wyt_sem_t const sem)
     return res == WAIT_OBJECT_0;
 }
 
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_bool_t wyt_wait(const wyt_word_t* const address, wyt_word_t const expected, wyt_utime_t const deadline)
+{
+    WYT_ASSUME(address != NULL);
+    _Static_assert(sizeof(wyt_word_t) == sizeof(UINT32), "`wyt_word_t` must be 32 bits");
+
+    const DWORD timeout = wyt_win32_timeout(deadline);
+    if (timeout == 0) return false;
+
+    wyt_word_t compare = expected;
+
+    /// @see WaitOnAddress | <Windows.h> <synchapi.h> [Synchronization] (Windows 8) | https://learn.microsoft.com/en-us/windows/win32/api/synchapi/nf-synchapi-waitonaddress
+    const BOOL res = WaitOnAddress((volatile VOID*)address, &compare, sizeof(compare), timeout);
+    if (res != 0) return true;
+
+    /// @see GetLastError | <Windows.h> <errhandlingapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/errhandlingapi/nf-errhandlingapi-getlasterror
+    WYT_ASSERT(GetLastError() == ERROR_TIMEOUT);
+
+    // As with every native timeout, expiry is only reported once the deadline has actually passed.
+    return wyt_nanotime() < deadline;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_wake_one(const wyt_word_t* const address)
+{
+    WYT_ASSUME(address != NULL);
+
+    /// @see WakeByAddressSingle | <Windows.h> <synchapi.h> [Synchronization] (Windows 8) | https://learn.microsoft.com/en-us/windows/win32/api/synchapi/nf-synchapi-wakebyaddresssingle
+    WakeByAddressSingle((PVOID)address);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_wake_all(const wyt_word_t* const address)
+{
+    WYT_ASSUME(address != NULL);
+
+    /// @see WakeByAddressAll | <Windows.h> <synchapi.h> [Synchronization] (Windows 8) | https://learn.microsoft.com/en-us/windows/win32/api/synchapi/nf-synchapi-wakebyaddressall
+    WakeByAddressAll((PVOID)address);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_topology_t* wyt_topology_query(void)
+{
+    // Only the first processor group is reported, matching the reach of thread affinity masks.
+    enum { max_cpus = 64 };
+    enum { key_core, key_package, key_node, key_l2, key_l3, key_len };
+
+    // Explicit cache keys are tagged so that they never collide with the fallback (core/package) keys.
+    static const unsigned long long cache_tag = 1uLL << 62;
+
+    /// @see GetProcessAffinityMask | <Windows.h> <winbase.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/winbase/nf-winbase-getprocessaffinitymask
+    DWORD_PTR process_mask, system_mask;
+    const BOOL res_mask = GetProcessAffinityMask(GetCurrentProcess(), &process_mask, &system_mask);
+    if ((res_mask == 0) || (process_mask == 0)) return NULL;
+
+    /// @see GetLogicalProcessorInformationEx | <Windows.h> <sysinfoapi.h> [Kernel32] (Windows 7) | https://learn.microsoft.com/en-us/windows/win32/api/sysinfoapi/nf-sysinfoapi-getlogicalprocessorinformationex
+    DWORD len = 0;
+    (void)GetLogicalProcessorInformationEx(RelationAll, NULL, &len);
+    if (len == 0) return NULL;
+
+    /// @see HeapAlloc | <Windows.h> <heapapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/heapapi/nf-heapapi-heapalloc
+    /// @see GetProcessHeap | <Windows.h> <heapapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/heapapi/nf-heapapi-getprocessheap
+    BYTE* const info = HeapAlloc(GetProcessHeap(), 0, len);
+    if (info == NULL) return NULL;
+
+    const BOOL res_info = GetLogicalProcessorInformationEx(RelationAll, (PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX)info, &len);
+    if (res_info == 0)
+    {
+        /// @see HeapFree | <Windows.h> <heapapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/heapapi/nf-heapapi-heapfree
+        (void)HeapFree(GetProcessHeap(), 0, info);
+        return NULL;
+    }
+
+    unsigned long long keys[key_len][max_cpus];
+    for (unsigned int cpu = 0; cpu < max_cpus; ++cpu)
+    {
+        keys[key_core][cpu] = (cache_tag << 1) | cpu;
+        keys[key_package][cpu] = 0;
+        keys[key_node][cpu] = 0;
+        keys[key_l2][cpu] = ~0uLL;
+        keys[key_l3][cpu] = ~0uLL;
+    }
+
+    size_t l1d_size = 0, l2_size = 0, l3_size = 0;
+    unsigned long long core_id = 0, package_id = 0;
+
+    for (DWORD offset = 0; offset < len; )
+    {
+        /// @see SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX | <Windows.h> <winnt.h> | https://learn.microsoft.com/en-us/windows/win32/api/winnt/ns-winnt-system_logical_processor_information_ex
+        const SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX* const entry = (const SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*)(info + offset);
+        offset += entry->Size;
+
+        KAFFINITY mask = 0;
+        unsigned int kind = key_len;
+        unsigned long long key = 0;
+
+        switch (entry->Relationship)
+        {
+            case RelationProcessorCore:
+            case RelationProcessorPackage:
+                for (WORD i = 0; i < entry->Processor.GroupCount; ++i)
+                {
+                    if (entry->Processor.GroupMask[i].Group == 0) mask |= entry->Processor.GroupMask[i].Mask;
+                }
+                kind = (entry->Relationship == RelationProcessorCore) ? key_core : key_package;
+                key = (entry->Relationship == RelationProcessorCore) ? core_id++ : package_id++;
+                break;
+
+            case RelationNumaNode:
+                if (entry->NumaNode.GroupMask.Group == 0) mask = entry->NumaNode.GroupMask.Mask;
+                kind = key_node;
+                key = entry->NumaNode.NodeNumber;
+                break;
+
+            case RelationCache:
+            {
+                if ((entry->Cache.Type != CacheData) && (entry->Cache.Type != CacheUnified)) break;
+                if (entry->Cache.GroupMask.Group == 0) mask = entry->Cache.GroupMask.Mask;
+                if (mask == 0) break;
+
+                // The lowest CPU sharing the cache identifies it.
+                unsigned int first = 0;
+                while (((mask >> first) & 1) == 0) ++first;
+                key = cache_tag | first;
+
+                if (entry->Cache.Level == 1) { if (l1d_size == 0) l1d_size = entry->Cache.CacheSize; }
+                if (entry->Cache.Level == 2) { if (l2_size == 0) l2_size = entry->Cache.CacheSize; kind = key_l2; }
+                if (entry->Cache.Level == 3) { if (l3_size == 0) l3_size = entry->Cache.CacheSize; kind = key_l3; }
+                break;
+            }
+
+            default:
+                break;
+        }
+
+        if (kind == key_len) continue;
+        for (unsigned int cpu = 0; cpu < max_cpus; ++cpu)
+        {
+            if ((mask >> cpu) & 1) keys[kind][cpu] = key;
+        }
+    }
+
+    (void)HeapFree(GetProcessHeap(), 0, info);
+
+    // Compacts the keys of the CPUs this process may run on.
+    unsigned int ids[max_cpus];
+    unsigned int count = 0;
+    for (unsigned int cpu = 0; cpu < max_cpus; ++cpu)
+    {
+        if (((process_mask >> cpu) & 1) == 0) continue;
+
+        if (keys[key_l2][cpu] == ~0uLL) keys[key_l2][cpu] = keys[key_core][cpu];
+        if (keys[key_l3][cpu] == ~0uLL) keys[key_l3][cpu] = keys[key_package][cpu];
+
+        for (unsigned int kind = 0; kind < key_len; ++kind) keys[kind][count] = keys[kind][cpu];
+        ids[count++] = cpu;
+    }
+
+    wyt_topology_t* const self = HeapAlloc(GetProcessHeap(), 0, sizeof(wyt_topology_t) + count * sizeof(wyt_cpu_t));
+    if (self == NULL) return NULL;
+
+    wyt_cpu_t* const cpus = (wyt_cpu_t*)(self + 1);
+    unsigned int indices[key_len][max_cpus];
+    unsigned int counts[key_len];
+    for (unsigned int kind = 0; kind < key_len; ++kind) counts[kind] = wyt_densify(keys[kind], indices[kind], count);
+
+    for (unsigned int i = 0; i < count; ++i)
+    {
+        cpus[i] = (wyt_cpu_t){
+            .id = ids[i],
+            .core = indices[key_core][i],
+            .package = indices[key_package][i],
+            .node = indices[key_node][i],
+            .l2 = indices[key_l2][i],
+            .l3 = indices[key_l3][i],
+        };
+    }
+
+    // Job objects can cap the CPU rate, in hundredths of a percent of the whole system.
+    unsigned int quota = count;
+    {
+        /// @see QueryInformationJobObject | <Windows.h> <jobapi2.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/jobapi2/nf-jobapi2-queryinformationjobobject
+        /// @see JOBOBJECT_CPU_RATE_CONTROL_INFORMATION | <Windows.h> <winnt.h> (Windows 8) | https://learn.microsoft.com/en-us/windows/win32/api/winnt/ns-winnt-jobobject_cpu_rate_control_information
+        JOBOBJECT_CPU_RATE_CONTROL_INFORMATION rate = {0};
+        const BOOL res_rate = QueryInformationJobObject(NULL, JobObjectCpuRateControlInformation, &rate, sizeof(rate), NULL);
+        const DWORD hard_cap = JOB_OBJECT_CPU_RATE_CONTROL_ENABLE | JOB_OBJECT_CPU_RATE_CONTROL_HARD_CAP;
+        if ((res_rate != 0) && ((rate.ControlFlags & hard_cap) == hard_cap) && ((rate.ControlFlags & JOB_OBJECT_CPU_RATE_CONTROL_MIN_MAX_RATE) == 0))
+        {
+            unsigned int system_cpus = 0;
+            for (unsigned int cpu = 0; cpu < max_cpus; ++cpu) system_cpus += (unsigned int)((system_mask >> cpu) & 1);
+
+            const unsigned long long cpus_rate = ((unsigned long long)rate.CpuRate * system_cpus + 9999uLL) / 10000uLL;
+            if ((cpus_rate != 0) && (cpus_rate < quota)) quota = (unsigned int)cpus_rate;
+        }
+    }
+
+    *self = (wyt_topology_t){
+        .cpu_count = count,
+        .core_count = counts[key_core],
+        .package_count = counts[key_package],
+        .node_count = counts[key_node],
+        .l2_count = counts[key_l2],
+        .l3_count = counts[key_l3],
+        .quota = quota,
+        .l1d_size = l1d_size,
+        .l2_size = l2_size,
+        .l3_size = l3_size,
+        .cpus = cpus,
+    };
+    return self;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_topology_free(wyt_topology_t* const topology)
+{
+    WYT_ASSUME(topology != NULL);
+
+    /// @see HeapFree | <Windows.h> <heapapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/heapapi/nf-heapapi-heapfree
+    const BOOL res = HeapFree(GetProcessHeap(), 0, topology);
+    WYT_ASSERT(res != 0);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_fiber_t wyt_fiber_create(wyt_fiber_entry_t const func, void* const arg, size_t const stack_size)
+{
+    WYT_ASSUME(func != NULL);
+
+    SIZE_T size = (stack_size != 0) ? (SIZE_T)stack_size : WYT_FIBER_STACK_DEFAULT;
+    if (size > (SIZE_T)-1 - WYT_FIBER_STACK_GRANULARITY) return NULL;
+    size = ((size + WYT_FIBER_STACK_GRANULARITY - 1) / WYT_FIBER_STACK_GRANULARITY) * WYT_FIBER_STACK_GRANULARITY;
+
+    struct wyt_fiber_impl_t* self = NULL;
+
+    /// @see AcquireSRWLockExclusive | <Windows.h> <synchapi.h> [Kernel32] (Windows Vista) | https://learn.microsoft.com/en-us/windows/win32/api/synchapi/nf-synchapi-acquiresrwlockexclusive
+    AcquireSRWLockExclusive(&wyt_win32_fiber_lock);
+    for (struct wyt_fiber_impl_t** link = &wyt_win32_fiber_pool; *link != NULL; link = &(*link)->next)
+    {
+        if ((*link)->size == size)
+        {
+            self = *link;
+            *link = self->next;
+            --wyt_win32_fiber_pooled;
+            break;
+        }
+    }
+    /// @see ReleaseSRWLockExclusive | <Windows.h> <synchapi.h> [Kernel32] (Windows Vista) | https://learn.microsoft.com/en-us/windows/win32/api/synchapi/nf-synchapi-releasesrwlockexclusive
+    ReleaseSRWLockExclusive(&wyt_win32_fiber_lock);
+
+    if (self == NULL)
+    {
+        /// @see HeapAlloc | <Windows.h> <heapapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/heapapi/nf-heapapi-heapalloc
+        self = HeapAlloc(GetProcessHeap(), 0, sizeof(struct wyt_fiber_impl_t));
+        if (self == NULL) return NULL;
+
+        // The stack is reserved with a guard page below its committed region.
+        /// @see CreateFiberEx | <Windows.h> <winbase.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/winbase/nf-winbase-createfiberex
+        self->handle = CreateFiberEx(0, size, FIBER_FLAG_FLOAT_SWITCH, wyt_win32_fiber_main, self);
+        if (self->handle == NULL)
+        {
+            /// @see HeapFree | <Windows.h> <heapapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/heapapi/nf-heapapi-heapfree
+            const BOOL res = HeapFree(GetProcessHeap(), 0, self);
+            WYT_ASSERT(res != 0);
+            return NULL;
+        }
+
+        self->size = size;
+    }
+
+    self->func = func;
+    self->arg = arg;
+    self->resumer = NULL;
+    self->next = NULL;
+    self->started = false;
+    self->done = false;
+    return self;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_fiber_destroy(wyt_fiber_t const fiber)
+{
+    struct wyt_fiber_impl_t* const self = (struct wyt_fiber_impl_t*)fiber;
+    WYT_ASSUME(self != NULL);
+    WYT_ASSUME(self != &wyt_win32_fiber_root);
+    WYT_ASSUME(self != wyt_win32_fiber_self);
+
+    // A native fiber can only be reused if it is parked between entry-functions in `wyt_win32_fiber_main`.
+    wyt_bool_t pooled = false;
+    if (self->done || !self->started)
+    {
+        AcquireSRWLockExclusive(&wyt_win32_fiber_lock);
+        if (wyt_win32_fiber_pooled < WYT_FIBER_POOL_MAX)
+        {
+            self->next = wyt_win32_fiber_pool;
+            wyt_win32_fiber_pool = self;
+            ++wyt_win32_fiber_pooled;
+            pooled = true;
+        }
+        ReleaseSRWLockExclusive(&wyt_win32_fiber_lock);
+    }
+
+    if (!pooled)
+    {
+        /// @see DeleteFiber | <Windows.h> <winbase.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/winbase/nf-winbase-deletefiber
+        DeleteFiber(self->handle);
+
+        /// @see HeapFree | <Windows.h> <heapapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/heapapi/nf-heapapi-heapfree
+        const BOOL res = HeapFree(GetProcessHeap(), 0, self);
+        WYT_ASSERT(res != 0);
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_fiber_t wyt_fiber_current(void)
+{
+    return wyt_win32_fiber_current();
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_fiber_switch(wyt_fiber_t const fiber)
+{
+    struct wyt_fiber_impl_t* const self = wyt_win32_fiber_current();
+    struct wyt_fiber_impl_t* const next = (struct wyt_fiber_impl_t*)fiber;
+    WYT_ASSUME(next != NULL);
+    WYT_ASSUME(!next->done);
+
+    if (next == self) return;
+
+    next->resumer = self;
+    next->started = true;
+    wyt_win32_fiber_self = next;
+
+    /// @see SwitchToFiber | <Windows.h> <winbase.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/winbase/nf-winbase-switchtofiber
+    SwitchToFiber(next->handle);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_arena_t wyt_arena_local(void)
+{
+    /// @see InitOnceExecuteOnce | <Windows.h> <synchapi.h> [Kernel32] (Windows Vista) | https://learn.microsoft.com/en-us/windows/win32/api/synchapi/nf-synchapi-initonceexecuteonce
+    const BOOL res_once = InitOnceExecuteOnce(&wyt_win32_arena_once, wyt_win32_arena_init, NULL, NULL);
+    if (res_once == 0) return NULL;
+
+    // The arena is only stored in its fiber-local slot, so that it is always destroyed along with the fiber that can see it.
+    /// @see FlsGetValue | <Windows.h> <fibersapi.h> [Kernel32] (Windows Vista) | https://learn.microsoft.com/en-us/windows/win32/api/fibersapi/nf-fibersapi-flsgetvalue
+    wyt_arena_t const local = FlsGetValue(wyt_win32_arena_fls);
+    if (local != NULL) return local;
+
+    wyt_arena_t const self = wyt_arena_create(0);
+    if (self == NULL) return NULL;
+
+    /// @see FlsSetValue | <Windows.h> <fibersapi.h> [Kernel32] (Windows Vista) | https://learn.microsoft.com/en-us/windows/win32/api/fibersapi/nf-fibersapi-flssetvalue
+    if (FlsSetValue(wyt_win32_arena_fls, self) == 0)
+    {
+        wyt_arena_destroy(self);
+        return NULL;
+    }
+
+    return self;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_tls_t wyt_tls_create(wyt_tls_destructor_t const destructor)
+{
+    /// @see InitOnceExecuteOnce | <Windows.h> <synchapi.h> [Kernel32] (Windows Vista) | https://learn.microsoft.com/en-us/windows/win32/api/synchapi/nf-synchapi-initonceexecuteonce
+    const BOOL res_once = InitOnceExecuteOnce(&wyt_win32_tls_once, wyt_win32_tls_init, NULL, NULL);
+    if (res_once == 0) return NULL;
+
+    /// @see HeapAlloc | <Windows.h> <heapapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/heapapi/nf-heapapi-heapalloc
+    struct wyt_tls_impl_t* const self = HeapAlloc(GetProcessHeap(), 0, sizeof(struct wyt_tls_impl_t));
+    if (self == NULL) return NULL;
+
+    self->destructor = destructor;
+
+    /// @see AcquireSRWLockExclusive | <Windows.h> <synchapi.h> [Kernel32] (Windows Vista) | https://learn.microsoft.com/en-us/windows/win32/api/synchapi/nf-synchapi-acquiresrwlockexclusive
+    AcquireSRWLockExclusive(&wyt_win32_tls_lock);
+    self->id = ++wyt_win32_tls_ids;
+    self->slot = WYT_TLS_SLOTS;
+    for (unsigned int slot = 0; slot < WYT_TLS_SLOTS; ++slot)
+    {
+        if (wyt_win32_tls_keys[slot] == NULL)
+        {
+            wyt_win32_tls_keys[slot] = self;
+            self->slot = slot;
+            break;
+        }
+    }
+    /// @see ReleaseSRWLockExclusive | <Windows.h> <synchapi.h> [Kernel32] (Windows Vista) | https://learn.microsoft.com/en-us/windows/win32/api/synchapi/nf-synchapi-releasesrwlockexclusive
+    ReleaseSRWLockExclusive(&wyt_win32_tls_lock);
+
+    if (self->slot == WYT_TLS_SLOTS)
+    {
+        /// @see HeapFree | <Windows.h> <heapapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/heapapi/nf-heapapi-heapfree
+        const BOOL res_free = HeapFree(GetProcessHeap(), 0, self);
+        WYT_ASSERT(res_free != 0);
+        return NULL;
+    }
+
+    return self;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_tls_destroy(wyt_tls_t const tls)
+{
+    struct wyt_tls_impl_t* const self = (struct wyt_tls_impl_t*)tls;
+    WYT_ASSUME(self != NULL);
+
+    // Entries of other fibers still holding the ID are ignored, since a new key never reuses it.
+    /// @see AcquireSRWLockExclusive | <Windows.h> <synchapi.h> [Kernel32] (Windows Vista) | https://learn.microsoft.com/en-us/windows/win32/api/synchapi/nf-synchapi-acquiresrwlockexclusive
+    AcquireSRWLockExclusive(&wyt_win32_tls_lock);
+    wyt_win32_tls_keys[self->slot] = NULL;
+    /// @see ReleaseSRWLockExclusive | <Windows.h> <synchapi.h> [Kernel32] (Windows Vista) | https://learn.microsoft.com/en-us/windows/win32/api/synchapi/nf-synchapi-releasesrwlockexclusive
+    ReleaseSRWLockExclusive(&wyt_win32_tls_lock);
+
+    /// @see HeapFree | <Windows.h> <heapapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/heapapi/nf-heapapi-heapfree
+    const BOOL res_free = HeapFree(GetProcessHeap(), 0, self);
+    WYT_ASSERT(res_free != 0);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void* wyt_tls_get(wyt_tls_t const tls)
+{
+    const struct wyt_tls_impl_t* const self = (const struct wyt_tls_impl_t*)tls;
+    WYT_ASSUME(self != NULL);
+
+    /// @see FlsGetValue | <Windows.h> <fibersapi.h> [Kernel32] (Windows Vista) | https://learn.microsoft.com/en-us/windows/win32/api/fibersapi/nf-fibersapi-flsgetvalue
+    const struct wyt_tls_values_t* const values = FlsGetValue(wyt_win32_tls_fls);
+    if (values == NULL) return NULL;
+
+    const struct wyt_tls_entry_t* const entry = &values->entries[self->slot];
+    return (entry->id == self->id) ? entry->value : NULL;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_bool_t wyt_tls_set(wyt_tls_t const tls, void* const value)
+{
+    const struct wyt_tls_impl_t* const self = (const struct wyt_tls_impl_t*)tls;
+    WYT_ASSUME(self != NULL);
+
+    // Values are only stored in the fiber-local slot, so that they are always destroyed along with the fiber that can see them.
+    /// @see FlsGetValue | <Windows.h> <fibersapi.h> [Kernel32] (Windows Vista) | https://learn.microsoft.com/en-us/windows/win32/api/fibersapi/nf-fibersapi-flsgetvalue
+    struct wyt_tls_values_t* values = FlsGetValue(wyt_win32_tls_fls);
+    if (values == NULL)
+    {
+        if (value == NULL) return true;
+
+        /// @see HeapAlloc | <Windows.h> <heapapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/heapapi/nf-heapapi-heapalloc
+        values = HeapAlloc(GetProcessHeap(), HEAP_ZERO_MEMORY, sizeof(struct wyt_tls_values_t));
+        if (values == NULL) return false;
+
+        /// @see FlsSetValue | <Windows.h> <fibersapi.h> [Kernel32] (Windows Vista) | https://learn.microsoft.com/en-us/windows/win32/api/fibersapi/nf-fibersapi-flssetvalue
+        if (FlsSetValue(wyt_win32_tls_fls, values) == 0)
+        {
+            /// @see HeapFree | <Windows.h> <heapapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/heapapi/nf-heapapi-heapfree
+            const BOOL res_free = HeapFree(GetProcessHeap(), 0, values);
+            WYT_ASSERT(res_free != 0);
+            return false;
+        }
+    }
+
+    struct wyt_tls_entry_t* const entry = &values->entries[self->slot];
+    entry->id = self->id;
+    entry->value = value;
+    return true;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_evsem_t wyt_evsem_create(const int initial)
+{
+    if (initial < 0) return NULL;
+
+    /// @see CreateSemaphoreExW | <Windows.h> <winbase.h> [Kernel32] (Windows Vista) | https://learn.microsoft.com/en-us/windows/win32/api/winbase/nf-winbase-createsemaphoreexa
+    const HANDLE handle = CreateSemaphoreExW(NULL, (LONG)initial, LONG_MAX, NULL, 0, SYNCHRONIZE | SEMAPHORE_MODIFY_STATE);
+    return (wyt_evsem_t)handle;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_evsem_destroy(wyt_evsem_t const evsem)
+{
+    WYT_ASSUME(evsem != NULL);
+    const HANDLE handle = (HANDLE)evsem;
+
+    /// @see CloseHandle | <Windows.h> <handleapi.h> [Kernel32] (Windows 2000) | https://learn.microsoft.com/en-us/windows/win32/api/handleapi/nf-handleapi-closehandle
+    const BOOL res = CloseHandle(handle);
+    WYT_ASSERT(res != 0);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_bool_t wyt_evsem_release(wyt_evsem_t const evsem)
+{
+    WYT_ASSUME(evsem != NULL);
+    const HANDLE handle = (HANDLE)evsem;
+
+    /// @see ReleaseSemaphore | <Windows.h> <synchapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/synchapi/nf-synchapi-releasesemaphore
+    const BOOL res = ReleaseSemaphore(handle, 1, NULL);
+    return res != 0;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_evsem_acquire(wyt_evsem_t const evsem)
+{
+    WYT_ASSUME(evsem != NULL);
+    const HANDLE handle = (HANDLE)evsem;
+
+    /// @see WaitForSingleObject | <Windows.h> <synchapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/synchapi/nf-synchapi-waitforsingleobject
+    const DWORD res = WaitForSingleObject(handle, INFINITE);
+    WYT_ASSERT(res == WAIT_OBJECT_0);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_bool_t wyt_evsem_try_acquire(wyt_evsem_t const evsem)
+{
+    WYT_ASSUME(evsem != NULL);
+    const HANDLE handle = (HANDLE)evsem;
+
+    /// @see WaitForSingleObject | <Windows.h> <synchapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/synchapi/nf-synchapi-waitforsingleobject
+    const DWORD res = WaitForSingleObject(handle, 0);
+    WYT_ASSERT((res == WAIT_OBJECT_0) || (res == WAIT_TIMEOUT));
+    return res == WAIT_OBJECT_0;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void* wyt_evsem_native(wyt_evsem_t const evsem)
+{
+    WYT_ASSUME(evsem != NULL);
+    return (void*)evsem;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern size_t wyt_wait_any(const wyt_evsem_t* const evsems, size_t const count, wyt_utime_t const deadline)
+{
+    WYT_ASSUME((evsems != NULL) && (count != 0) && (count <= MAXIMUM_WAIT_OBJECTS));
+
+    // Waiting on a semaphore decrements it, and only the first signaled handle is acquired.
+    HANDLE handles[MAXIMUM_WAIT_OBJECTS];
+    for (size_t i = 0; i < count; ++i) handles[i] = (HANDLE)evsems[i];
+
+    for (;;)
+    {
+        const DWORD timeout = wyt_win32_timeout(deadline);
+
+        /// @see WaitForMultipleObjects | <Windows.h> <synchapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/synchapi/nf-synchapi-waitformultipleobjects
+        const DWORD res = WaitForMultipleObjects((DWORD)count, handles, FALSE, timeout);
+        if (res - WAIT_OBJECT_0 < (DWORD)count) return (size_t)(res - WAIT_OBJECT_0);
+        WYT_ASSERT(res == WAIT_TIMEOUT);
+
+        if (timeout == 0) return count;
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_sem_t wyt_sem_open(const char* const name, const int maximum, const int initial)
+{
+    if ((maximum < initial) || (maximum < 0) || (initial < 0)) return NULL;
+
+    WCHAR path[WYT_NAME_MAX];
+    if (!wyt_win32_name(path, name, L".sem")) return NULL;
+
+    // Opens the existing semaphore if there is one, in which case the counts are ignored.
+    /// @see CreateSemaphoreExW | <Windows.h> <winbase.h> [Kernel32] (Windows Vista) | https://learn.microsoft.com/en-us/windows/win32/api/winbase/nf-winbase-createsemaphoreexa
+    const HANDLE handle = CreateSemaphoreExW(NULL, (LONG)initial, (LONG)maximum, path, 0, SYNCHRONIZE | SEMAPHORE_MODIFY_STATE);
+    return (wyt_sem_t)handle;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_sem_unlink(const char* const name)
+{
+    WYT_ASSUME(name != NULL);
+    (void)name;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern wyt_shm_t wyt_shm_open(const char* const name, size_t const size)
+{
+    if (size == 0) return NULL;
+
+    WCHAR path[WYT_NAME_MAX];
+    if (!wyt_win32_name(path, name, L".shm")) return NULL;
+
+    /// @see HeapAlloc | <Windows.h> <heapapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/heapapi/nf-heapapi-heapalloc
+    struct wyt_shm_impl_t* const self = HeapAlloc(GetProcessHeap(), 0, sizeof(struct wyt_shm_impl_t));
+    if (self == NULL) return NULL;
+
+    // Sections backed by the paging file are zero-filled. Opening an existing section ignores the size.
+    /// @see CreateFileMappingW | <Windows.h> <memoryapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/memoryapi/nf-memoryapi-createfilemappingw
+    const unsigned long long size64 = (unsigned long long)size;
+    self->mapping = CreateFileMappingW(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE, (DWORD)(size64 >> 32), (DWORD)size64, path);
+    if (self->mapping != NULL)
+    {
+        // Mapping more than an existing section holds fails, which rejects sections that are too small.
+        /// @see MapViewOfFile | <Windows.h> <memoryapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/memoryapi/nf-memoryapi-mapviewoffile
+        self->data = MapViewOfFile(self->mapping, FILE_MAP_READ | FILE_MAP_WRITE, 0, 0, size);
+        self->size = size;
+        if (self->data != NULL) return (wyt_shm_t)self;
+
+        /// @see CloseHandle | <Windows.h> <handleapi.h> [Kernel32] (Windows 2000) | https://learn.microsoft.com/en-us/windows/win32/api/handleapi/nf-handleapi-closehandle
+        const BOOL res_close = CloseHandle(self->mapping);
+        WYT_ASSERT(res_close != 0);
+    }
+
+    /// @see HeapFree | <Windows.h> <heapapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/heapapi/nf-heapapi-heapfree
+    const BOOL res_free = HeapFree(GetProcessHeap(), 0, self);
+    WYT_ASSERT(res_free != 0);
+    return NULL;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_shm_close(wyt_shm_t const shm)
+{
+    WYT_ASSUME(shm != NULL);
+    struct wyt_shm_impl_t* const self = (struct wyt_shm_impl_t*)shm;
+
+    /// @see UnmapViewOfFile | <Windows.h> <memoryapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/memoryapi/nf-memoryapi-unmapviewoffile
+    const BOOL res_unmap = UnmapViewOfFile(self->data);
+    WYT_ASSERT(res_unmap != 0);
+
+    /// @see CloseHandle | <Windows.h> <handleapi.h> [Kernel32] (Windows 2000) | https://learn.microsoft.com/en-us/windows/win32/api/handleapi/nf-handleapi-closehandle
+    const BOOL res_close = CloseHandle(self->mapping);
+    WYT_ASSERT(res_close != 0);
+
+    /// @see HeapFree | <Windows.h> <heapapi.h> [Kernel32] (Windows XP) | https://learn.microsoft.com/en-us/windows/win32/api/heapapi/nf-heapapi-heapfree
+    const BOOL res_free = HeapFree(GetProcessHeap(), 0, self);
+    WYT_ASSERT(res_free != 0);
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void* wyt_shm_data(wyt_shm_t const shm)
+{
+    WYT_ASSUME(shm != NULL);
+    const struct wyt_shm_impl_t* const self = (const struct wyt_shm_impl_t*)shm;
+
+    return self->data;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern size_t wyt_shm_size(wyt_shm_t const shm)
+{
+    WYT_ASSUME(shm != NULL);
+    const struct wyt_shm_impl_t* const self = (const struct wyt_shm_impl_t*)shm;
+
+    return self->size;
+}
+
+// --------------------------------------------------------------------------------------------------------------------------------
+
+extern void wyt_shm_unlink(const char* const name)
+{
+    WYT_ASSUME(name != NULL);
+    (void)name;
+}
+
 // ================================================================================================================================